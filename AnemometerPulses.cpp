@@ -0,0 +1,102 @@
+// 
+// 
+// 
+
+#include "AnemometerPulses.h"
+
+/// <summary>
+/// Creates an instance for an anemometer.
+/// </summary>
+/// <param name="calibrationFactor">Speed (mph) of one rotation per second.</param>
+AnemometerPulses::AnemometerPulses(float calibrationFactor)
+	: _calibrationFactor(calibrationFactor) {}
+
+/// <summary>
+/// Adds pulse times, oldest first.
+/// </summary>
+/// <param name="times">Pulse times, micros().</param>
+/// <param name="count">Number of times.</param>
+/// <returns>Number of pulses accepted.</returns>
+unsigned int AnemometerPulses::add(const uint32_t* times, unsigned int count) {
+	unsigned int numAccepted = 0;
+	for (unsigned int i = 0; i < count; i++) {
+		numAccepted += accept(times[i]);
+	}
+	return numAccepted;
+}
+
+/// <summary>
+/// Adds one pulse time, unless it is a bounce or a false pulse,
+/// and updates the gust window and peak.
+/// </summary>
+/// <returns>True if accepted.</returns>
+bool AnemometerPulses::accept(uint32_t time) {
+	uint32_t interval = 0;
+	if (_count > 0) {
+		interval = time - _times[_newest];	// Wraps correctly.
+		if (interval < App_Settings::ANEM_DEBOUNCE_US) {
+			_rejected++;
+			return false;
+		}
+		// A false pulse splits a rotation, so its interval is much
+		// shorter than the last one. A real speed-up continues, so
+		// never drop two pulses in a row.
+		if (!_isLastOutlier && _lastInterval > 0
+			&& interval < App_Settings::ANEM_PULSE_OUTLIER_RATIO * _lastInterval) {
+			_isLastOutlier = true;
+			_rejected++;
+			return false;
+		}
+	}
+	_isLastOutlier = false;
+	_lastInterval = interval;
+	_newest = (_newest + 1) % App_Settings::ANEM_PULSE_HISTORY;
+	_times[_newest] = time;
+	if (_count < App_Settings::ANEM_PULSE_HISTORY) {
+		_count++;
+	}
+	if (_inWindow < _count) {
+		_inWindow++;
+	}
+	// Drop times that are no longer within the window ending now.
+	const uint32_t window_us = App_Settings::GUST_WINDOW_SEC * App_Settings::MICROSEC_PER_SECOND;
+	unsigned int oldest = (_newest + App_Settings::ANEM_PULSE_HISTORY - _inWindow + 1) % App_Settings::ANEM_PULSE_HISTORY;
+	while (_inWindow > 1 && time - _times[oldest] >= window_us) {
+		_inWindow--;
+		oldest = (oldest + 1) % App_Settings::ANEM_PULSE_HISTORY;
+	}
+	float speed = _inWindow * _calibrationFactor / App_Settings::GUST_WINDOW_SEC;
+	if (speed > _peak) {
+		_peak = speed;
+	}
+	_accepted++;
+	return true;
+}
+
+/// <summary>
+/// Returns the speed of the last rotation, or slower if the
+/// next pulse is overdue; 0 if calm.
+/// </summary>
+/// <param name="now_us">Current micros().</param>
+/// <returns>Wind speed, mph.</returns>
+float AnemometerPulses::speedInstant(uint32_t now_us) const {
+	if (_count < 2) {
+		return 0;
+	}
+	uint32_t interval = std::max(_lastInterval, now_us - _times[_newest]);
+	if (interval >= App_Settings::ANEM_CALM_US) {
+		return 0;
+	}
+	return _calibrationFactor * App_Settings::MICROSEC_PER_SECOND / interval;
+}
+
+/// <summary>
+/// Returns the peak mean speed over GUST_WINDOW_SEC since
+/// the last call, and starts a new peak.
+/// </summary>
+/// <returns>Peak speed, mph, or 0 if no pulses.</returns>
+float AnemometerPulses::takePeak() {
+	float peak = _peak;
+	_peak = 0;
+	return peak;
+}
@@ -0,0 +1,76 @@
+// AnemometerPulses.h
+
+#ifndef _ANEMOMETERPULSES_h
+#define _ANEMOMETERPULSES_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <algorithm>
+#include "App_Settings.h"
+
+/// <summary>
+/// Measures wind speed from the times (micros) of anemometer
+/// pulses, one per rotation, as queued by the anemometer ISR.
+/// Pulses are added in batches; bounces and lone false pulses
+/// are dropped. Gives the speed of the last rotation, and the
+/// peak mean speed over GUST_WINDOW_SEC (the WMO 3-s gust),
+/// which a count over a whole base period cannot resolve.
+/// Acquisition task only.
+/// </summary>
+class AnemometerPulses {
+
+public:
+
+	/// <summary>
+	/// Creates an instance for an anemometer.
+	/// </summary>
+	/// <param name="calibrationFactor">Speed (mph) of one rotation per second.</param>
+	AnemometerPulses(float calibrationFactor);
+
+	/// <summary>
+	/// Adds pulse times, oldest first.
+	/// </summary>
+	/// <param name="times">Pulse times, micros().</param>
+	/// <param name="count">Number of times.</param>
+	/// <returns>Number of pulses accepted.</returns>
+	unsigned int add(const uint32_t* times, unsigned int count);
+
+	/// <summary>
+	/// Returns the speed of the last rotation, or slower if the
+	/// next pulse is overdue; 0 if calm.
+	/// </summary>
+	/// <param name="now_us">Current micros().</param>
+	/// <returns>Wind speed, mph.</returns>
+	float speedInstant(uint32_t now_us) const;
+
+	/// <summary>
+	/// Returns the peak mean speed over GUST_WINDOW_SEC since
+	/// the last call, and starts a new peak.
+	/// </summary>
+	/// <returns>Peak speed, mph, or 0 if no pulses.</returns>
+	float takePeak();
+
+	unsigned long accepted() const { return _accepted; }
+	unsigned long rejected() const { return _rejected; }
+
+private:
+
+	float _calibrationFactor;
+	uint32_t _times[App_Settings::ANEM_PULSE_HISTORY];	// Accepted pulse times (ring).
+	unsigned int _newest = 0;		// Index of newest time.
+	unsigned int _count = 0;		// Times held.
+	unsigned int _inWindow = 0;		// Times within the gust window of the newest.
+	uint32_t _lastInterval = 0;		// Interval before newest pulse, us.
+	bool _isLastOutlier = false;	// Last pulse was dropped as a false pulse.
+	float _peak = 0;				// Peak window speed since takePeak().
+	unsigned long _accepted = 0;
+	unsigned long _rejected = 0;
+
+	bool accept(uint32_t time);
+};
+
+#endif
@@ -62,12 +62,18 @@ namespace App_Settings {
 	const String SENSOR_DATA_DIR_PATH = "/Sensor data";	// Absolute path to sensor data files directory.
 	const String SENSOR_DATA_TIME_FILE_PATH = "/Sensor data/last_time.txt";	// Absolute path to sensor read time file.
 
-	const int DATA_FILE_BUFFER_SIZE = 1024;			// Size of the buffer when reading a readings data file from file system.
+	const int DATA_FILE_BUFFER_SIZE = 256;			// Size of each block read from a file in file system.
 
 	const String LOGFILE_PATH_DATA = "/data.txt";
 
 	const String LOGFILE_PATH_STATUS = "/log.txt";
 
+	const unsigned int LOG_BUFFER_SIZE_STATUS = 4096;	// RAM buffer for status log, bytes.
+	const unsigned int LOG_BUFFER_SIZE_DATA = 2048;		// RAM buffer for data log, bytes.
+	const unsigned int LOG_FLUSH_BYTES = 1024;			// Flush log when this many bytes are waiting.
+	const unsigned long LOG_FLUSH_AGE_MS = 5000;		// Flush log when oldest text is this old, ms.
+	const unsigned int LOG_FLUSH_TASK_STACK = 4096;		// Stack size of log flush task, bytes.
+
 	const String LINE_SEPARATOR_LOG_BEGINS = "$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$$";
 	const String LINE_SEPARATOR_MAJOR = "=====================================================";
 	const String LINE_SEPARATOR = "-------------------------------------------------";
@@ -86,9 +92,30 @@ namespace App_Settings {
 	const float WIND_DIRECTION_SPEED_THRESHOLD = 1;	// WindSpeed below which wind direction is not reported.
 	const float WIND_SPEED_OUTLIER_DELTA = 10;
 	const unsigned int WIND_SPEED_NUMBER_IN_MOVING_AVG = 5;
-
-
-	const unsigned int LOOP_TIME_WARNING_THRESHOLD_MS = 2000;
+	const unsigned int ANEM_PULSE_QUEUE_SIZE = 512;	// Anemometer pulse times waiting for acquisition (power of 2).
+	const unsigned int ANEM_PULSE_HISTORY = 256;	// Pulse times kept for the gust window (above 150 mph for 3 s).
+	const unsigned long ANEM_DEBOUNCE_US = 15000;	// Pulses closer than this are switch bounce (150 mph).
+	const float ANEM_PULSE_OUTLIER_RATIO = 0.5;		// Interval shorter than this part of the last is a false pulse.
+	const unsigned long ANEM_CALM_US = 10000000;	// No pulse for this long is calm.
+	const float GUST_WINDOW_SEC = 3;				// Gust is the peak mean speed over this window (WMO).
+	const unsigned int SUSTAINED_WIND_PERIODS = 30;	// Base periods in the 2-min sustained wind (NWS).
+	const float GUST_THRESHOLD = 18.41;			// Peak must reach this to be a gust, mph (16 kt).
+	const float GUST_SPREAD = 10.36;			// Peak must exceed the 10-min lull by this to be a gust, mph (9 kt).
+	const float PEAK_WIND_THRESHOLD = 28.77;	// Peak above this is reported as peak wind, mph (25 kt).
+	const unsigned int DIRECTION_SECTORS = 16;		// Wind rose sectors (22.5 deg each, first centred on N).
+
+
+	const unsigned int LOOP_TIME_WARNING_THRESHOLD_MS = 2000;	// Warn if acquiring or processing a sample takes longer.
+
+	const unsigned int SAMPLE_QUEUE_SIZE = 32;				// Samples waiting for processing (power of 2; 128 s, over a 60-s WiFi reconnect).
+	const unsigned int TICK_QUEUE_SIZE = 32;				// Timer ticks waiting for acquisition (power of 2; 128 s).
+	const unsigned int ACQUISITION_TASK_STACK = 4096;		// Stack size of acquisition task, bytes.
+	const unsigned int ACQUISITION_TASK_PRIORITY = 3;		// Above loop() (1), which shares its core.
+	const int ACQUISITION_TASK_CORE = 1;					// Core of acquisition task (APP_CPU).
+	const unsigned int PROCESSING_TASK_STACK = 8192;		// Stack size of processing task, bytes.
+	const unsigned int PROCESSING_TASK_PRIORITY = 2;		// Priority of processing task.
+	const int PROCESSING_TASK_CORE = 0;						// Core of processing task (PRO_CPU).
+	const unsigned int WIFI_CHECK_PERIOD_MS = 1000;			// loop() checks WiFi this often.
 
 	/// <summary>
 	/// Enumerate lists of sensor data of different periods.
@@ -101,6 +128,42 @@ namespace App_Settings {
 
 	////////////////////////const char* dataPeriodName[] = { "10_MIN", "60_MIN", "DAY" };
 
+	/// <summary>
+	/// Enumerate data series sent to charts.
+	/// </summary>
+	enum dataSeries {
+		SERIES_10_MIN,
+		SERIES_60_MIN,
+		SERIES_DAY_MAX_MIN,
+		SERIES_DAY_MAX,
+		SERIES_DAY_MIN
+	};
+
+	/// <summary>
+	/// Enumerate what a sensor saves as the value of a period.
+	/// </summary>
+	enum periodValue {
+		PERIOD_VALUE_AVERAGE,	// Average of the readings.
+		PERIOD_VALUE_LAST,		// Last reading, for values already taken over a window.
+		PERIOD_VALUE_MAX,		// Largest reading.
+		PERIOD_VALUE_MIN		// Smallest reading.
+	};
+
+	const float SERIES_SCALE_DEFAULT = 0.01;		// Value of one count in 10/60-min lists (range +-327.67).
+	const unsigned int SERIES_PERIOD_10_MIN_SEC = 600;	// Seconds between points of 10-min lists.
+	const unsigned int SERIES_PERIOD_60_MIN_SEC = 3600;	// Seconds between points of 60-min lists.
+	const unsigned int ARCHIVE_BLOCK_SIZE = 256;		// Bytes per compressed block of archive files.
+	const unsigned int ARCHIVE_60_MIN_BLOCKS = 160;	// Blocks of 60-min archive (a year at up to ~4 bytes per point).
+	const unsigned int ARCHIVE_DAY_BLOCKS = 16;		// Blocks of each day max and min archive (over a year).
+	const unsigned int ARCHIVE_QUERY_POINTS = 366;		// Max points sent for an archive range.
+	const unsigned long ARCHIVE_QUERY_DEFAULT_SEC = 365UL * 86400;	// Archive range when none is given.
+	const unsigned int SENSOR_REGISTRY_SIZE = 20;	// Max number of registered SensorData instances.
+	const unsigned int PAGE_CACHE_SIZE = 2;			// Max number of rendered html pages held in RAM.
+	const unsigned int SERIES_READ_ATTEMPTS = 3;		// Data route copies of a series, without waiting, before 503.
+	const unsigned int SERIES_COPY_BUFFERS = 2;		// Data series copies being sent at once.
+	const unsigned int SENSOR_SCHEDULE_SIZE = 8;	// Max number of scheduled sensor reads.
+	const unsigned int SENSOR_READ_PERIOD = 5;		// Base periods between reads of slow sensors (20 s).
+
 	/// <summary>
 	/// Max size of data lists.
 	/// </summary>
@@ -120,6 +183,10 @@ namespace App_Settings {
 		BASE_PERIODS_IN_24_HR = 21600	// 86400 sec
 	};
 
+	// Every 10-min average then has the same number of readings.
+	static_assert(BASE_PERIODS_IN_10_MIN % SENSOR_READ_PERIOD == 0,
+		"SENSOR_READ_PERIOD must divide BASE_PERIODS_IN_10_MIN.");
+
 	/// <summary>
 	/// Enumerates data charts requested from the web server.
 	/// </summary>
@@ -127,7 +194,10 @@ namespace App_Settings {
 		CHART_NONE,
 		CHART_WIND_SPEED,
 		CHART_WIND_GUST,
+		CHART_WIND_SUSTAINED,
+		CHART_WIND_PEAK,
 		CHART_WIND_DIRECTION,
+		CHART_WIND_SIGMA,
 		CHART_TEMPERATURE_F,
 		CHART_PRESSURE_SEA_LEVEL,
 		CHART_RELATIVE_HUMIDITY,
@@ -0,0 +1,90 @@
+// 
+// 
+// 
+
+#include "CircularStats.h"
+
+/// <summary>
+/// Adds a direction.
+/// </summary>
+/// <param name="degrees">Direction, whole deg.</param>
+void CircularStats::add(int degrees) {
+	_sinSum += FastTrig::sinDeg(degrees);
+	_cosSum += FastTrig::cosDeg(degrees);
+	_count++;
+	_sectors[sectorOf(degrees)]++;
+}
+
+/// <summary>
+/// Adds the directions of another period.
+/// </summary>
+/// <param name="other">Stats of the other period.</param>
+void CircularStats::merge(const CircularStats& other) {
+	_sinSum += other._sinSum;
+	_cosSum += other._cosSum;
+	_count += other._count;
+	for (unsigned int i = 0; i < SECTORS; i++) {
+		_sectors[i] += other._sectors[i];
+	}
+}
+
+/// <summary>
+/// Removes all directions.
+/// </summary>
+void CircularStats::clear() {
+	*this = CircularStats();
+}
+
+/// <summary>
+/// Returns the Yamartino estimate of the standard
+/// deviation of direction, or 0 if none were added.
+/// </summary>
+/// <returns>Sigma-theta, 0-103.9 deg.</returns>
+float CircularStats::sigmaTheta() const {
+	if (_count == 0) {
+		return 0;
+	}
+	/*
+		Yamartino (1984): with sa and ca the mean sin and cos,
+			epsilon = sqrt(1 - (sa^2 + ca^2))
+			sigma = asin(epsilon) * (1 + (2/sqrt(3) - 1) * epsilon^3)
+		A single pass, within a few percent of the standard
+		deviation of the unwrapped directions.
+	*/
+	float sa = _sinSum / _count;
+	float ca = _cosSum / _count;
+	float epsilon = sqrtf(std::max(0.0f, 1 - (sa * sa + ca * ca)));
+	epsilon = std::min(epsilon, 1.0f);	// Rounding.
+	float sigma = asinf(epsilon) * (1 + 0.1547005f * epsilon * epsilon * epsilon);
+	return sigma * 180 / (float)M_PI;
+}
+
+/// <summary>
+/// Returns the number of directions in a sector.
+/// </summary>
+/// <param name="sector">Sector, 0 (N) to SECTORS - 1, clockwise.</param>
+unsigned long CircularStats::sectorCount(unsigned int sector) const {
+	return (sector < SECTORS) ? _sectors[sector] : 0;
+}
+
+/// <summary>
+/// Returns the percent of directions in a sector,
+/// or 0 if none were added.
+/// </summary>
+/// <param name="sector">Sector, 0 (N) to SECTORS - 1, clockwise.</param>
+float CircularStats::sectorPercent(unsigned int sector) const {
+	if (_count == 0) {
+		return 0;
+	}
+	return 100.0f * sectorCount(sector) / _count;
+}
+
+/// <summary>
+/// Returns the sector of a direction.
+/// </summary>
+/// <param name="degrees">Direction, whole deg.</param>
+/// <returns>Sector, 0 (N) to SECTORS - 1, clockwise.</returns>
+unsigned int CircularStats::sectorOf(int degrees) {
+	// Sectors are centred on their angle, so shift by half a sector.
+	return ((unsigned int)FastTrig::wrapDeg(degrees) * SECTORS + 180) / 360 % SECTORS;
+}
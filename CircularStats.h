@@ -0,0 +1,91 @@
+// CircularStats.h
+
+#ifndef _CIRCULARSTATS_h
+#define _CIRCULARSTATS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <algorithm>
+#include "App_Settings.h"
+#include "FastTrig.h"
+
+/// <summary>
+/// Running statistics of wind directions: unit-vector sums for
+/// the Yamartino standard deviation (sigma-theta), and counts
+/// by DIRECTION_SECTORS sector for a wind rose. Each reading is
+/// O(1), and stats of consecutive periods merge into those of a
+/// longer period, so no readings are kept.
+/// </summary>
+class CircularStats {
+
+public:
+
+	static const unsigned int SECTORS = App_Settings::DIRECTION_SECTORS;
+
+	/// <summary>
+	/// Adds a direction.
+	/// </summary>
+	/// <param name="degrees">Direction, whole deg.</param>
+	void add(int degrees);
+
+	/// <summary>
+	/// Adds the directions of another period.
+	/// </summary>
+	/// <param name="other">Stats of the other period.</param>
+	void merge(const CircularStats& other);
+
+	/// <summary>
+	/// Removes all directions.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Returns the number of directions added.
+	/// </summary>
+	unsigned long count() const { return _count; }
+
+	/// <summary>
+	/// Returns the Yamartino estimate of the standard
+	/// deviation of direction, or 0 if none were added.
+	/// </summary>
+	/// <returns>Sigma-theta, 0-103.9 deg.</returns>
+	float sigmaTheta() const;
+
+	/// <summary>
+	/// Returns the number of directions in a sector.
+	/// </summary>
+	/// <param name="sector">Sector, 0 (N) to SECTORS - 1, clockwise.</param>
+	unsigned long sectorCount(unsigned int sector) const;
+
+	/// <summary>
+	/// Returns the percent of directions in a sector,
+	/// or 0 if none were added.
+	/// </summary>
+	/// <param name="sector">Sector, 0 (N) to SECTORS - 1, clockwise.</param>
+	float sectorPercent(unsigned int sector) const;
+
+	/// <summary>
+	/// Returns the sector of a direction.
+	/// </summary>
+	/// <param name="degrees">Direction, whole deg.</param>
+	/// <returns>Sector, 0 (N) to SECTORS - 1, clockwise.</returns>
+	static unsigned int sectorOf(int degrees);
+
+	/// <summary>
+	/// Returns the direction at the centre of a sector, deg.
+	/// </summary>
+	static float sectorAngle(unsigned int sector) { return 360.0f * sector / SECTORS; }
+
+private:
+
+	float _sinSum = 0;		// Sum of sin of directions (East component).
+	float _cosSum = 0;		// Sum of cos of directions (North component).
+	unsigned long _count = 0;
+	uint32_t _sectors[SECTORS] = {};	// Directions in each sector.
+};
+
+#endif
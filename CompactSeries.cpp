@@ -0,0 +1,138 @@
+// 
+// 
+// 
+
+#include "CompactSeries.h"
+
+/// <summary>
+/// Creates an empty series over existing storage.
+/// </summary>
+/// <param name="storage">Array of at least capacity values.</param>
+/// <param name="runTimes">Array of at least capacity run times.</param>
+/// <param name="runStarts">Array of at least capacity run indexes.</param>
+/// <param name="capacity">Number of values in storage (at most 255).</param>
+/// <param name="period">Seconds between points.</param>
+/// <param name="scale">Value of one count, such as 0.01.</param>
+CompactSeries::CompactSeries(int16_t* storage, uint32_t* runTimes, uint8_t* runStarts,
+	unsigned int capacity, unsigned int period, float scale) :
+	_values(storage), _runTime(runTimes), _runStart(runStarts),
+	_capacity(capacity), _period(period), _scale(scale)
+{}
+
+/// <summary>
+/// Copies points from another series, keeping this scale.
+/// If the source holds more points than this capacity,
+/// only the newest are kept.
+/// </summary>
+/// <param name="other">Series to copy.</param>
+CompactSeries& CompactSeries::operator=(const CompactSeries& other) {
+	if (this != &other) {
+		clear();
+		unsigned int first = (other._count > _capacity) ? other._count - _capacity : 0;
+		for (unsigned int i = first; i < other._count; i++) {
+			push_back(other[i]);
+		}
+	}
+	return *this;
+}
+
+/// <summary>
+/// Adds a point after the newest. If the series is full,
+/// the oldest point is overwritten.
+/// </summary>
+/// <param name="dp">Point to add.</param>
+void CompactSeries::push_back(const dataPoint& dp) {
+	bool isOnGrid = false;
+	if (_count > 0) {
+		long offset = (long)(dp.time - (back().time + _period));
+		isOnGrid = (unsigned long)labs(offset) <= _period / 2;
+	}
+	if (_count == _capacity) {
+		pop_front();	// Overwrite oldest.
+	}
+	if (!isOnGrid) {
+		startRun(dp.time);
+	}
+	int16_t counts = NAN_COUNTS;
+	if (!isnan(dp.value)) {
+		float scaled = roundf(dp.value / _scale);
+		if (scaled > 32767 || scaled < -32767) {
+			_numClamped++;
+			Serial.printf("WARNING: CompactSeries value %.2f clamped to +-%.2f.\n",
+				dp.value, 32767 * _scale);
+			scaled = (scaled > 0) ? 32767 : -32767;
+		}
+		counts = (int16_t)scaled;
+	}
+	_values[(_head + _count) % _capacity] = counts;
+	_count++;
+}
+
+/// <summary>
+/// Starts a run at the next point added. Each run holds at
+/// least one point, so there is always room for it.
+/// </summary>
+void CompactSeries::startRun(unsigned long time) {
+	_runTime[_numRuns] = time;
+	_runStart[_numRuns] = _count;
+	_numRuns++;
+}
+
+/// <summary>
+/// Removes the oldest point, if any.
+/// </summary>
+void CompactSeries::pop_front() {
+	if (_count == 0) {
+		return;
+	}
+	_head = (_head + 1) % _capacity;
+	_count--;
+	// The first run now starts a period later; later runs start
+	// one index earlier. Drop the first run once it is empty.
+	_runTime[0] += _period;
+	for (unsigned int r = 1; r < _numRuns; r++) {
+		_runStart[r]--;
+	}
+	if (_count == 0) {
+		_numRuns = 0;
+	}
+	else if (_numRuns > 1 && _runStart[1] == 0) {
+		for (unsigned int r = 1; r < _numRuns; r++) {
+			_runTime[r - 1] = _runTime[r];
+			_runStart[r - 1] = _runStart[r];
+		}
+		_numRuns--;
+	}
+}
+
+/// <summary>
+/// Removes all points.
+/// </summary>
+void CompactSeries::clear() {
+	_head = 0;
+	_count = 0;
+	_numRuns = 0;
+}
+
+/// <summary>
+/// Returns point by age, where 0 is the oldest.
+/// </summary>
+/// <param name="index">Index from 0 to size() - 1.</param>
+dataPoint CompactSeries::operator[](unsigned int index) const {
+	unsigned int r = _numRuns - 1;
+	while (r > 0 && _runStart[r] > index) {
+		r--;
+	}
+	unsigned long time = _runTime[r] + (unsigned long)(index - _runStart[r]) * _period;
+	int16_t counts = _values[(_head + index) % _capacity];
+	return dataPoint(time, (counts == NAN_COUNTS) ? NAN : counts * _scale);
+}
+
+/// <summary>
+/// Sets the value of one count, and removes all points.
+/// </summary>
+/// <param name="scale">Value of one count, such as 0.01.</param>
+void CompactSeries::setScale(float scale) {
+	_scale = scale;
+	clear();
+}
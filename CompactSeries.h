@@ -0,0 +1,181 @@
+// CompactSeries.h
+
+#ifndef _COMPACTSERIES_h
+#define _COMPACTSERIES_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <algorithm>
+#include "App_Settings.h"
+#include "DataPoint.h"
+
+/// <summary>
+/// Circular buffer of evenly spaced dataPoints, held as one int16
+/// per value (value / scale) and (time, index) runs, rather than
+/// a time and a float per point. A point that is not one period
+/// (within half a period) after the last starts a new run. There
+/// is room for a run per point, so gaps never cost points; only
+/// a full series drops its oldest point. Times are given on the
+/// period grid of their run. NaN is kept (as INT16_MIN), so a
+/// failed reading stays a gap; other values outside +-32767 *
+/// scale are clamped, counted and logged. Storage is owned by a
+/// derived class (see FixedCompactSeries), so no memory is
+/// allocated after construction.
+/// </summary>
+class CompactSeries {
+
+protected:
+
+	static const int16_t NAN_COUNTS = INT16_MIN;	// Stored for a NaN value.
+
+	int16_t* _values;			// Values / scale (owned by derived class).
+	uint32_t* _runTime;			// Time of first point of each run (owned by derived class).
+	uint8_t* _runStart;			// Index of first point of each run (owned by derived class).
+	uint8_t _capacity;			// Number of values storage can hold.
+	uint8_t _head = 0;			// Storage index of the oldest value.
+	uint8_t _count = 0;			// Number of values held.
+	uint8_t _numRuns = 0;		// Runs in use.
+	uint16_t _period;			// Seconds between points.
+	float _scale;				// Value of one count.
+	unsigned int _numClamped = 0;	// Values clamped to the int16 range.
+
+	/// <summary>
+	/// Creates an empty series over existing storage.
+	/// </summary>
+	/// <param name="storage">Array of at least capacity values.</param>
+	/// <param name="runTimes">Array of at least capacity run times.</param>
+	/// <param name="runStarts">Array of at least capacity run indexes.</param>
+	/// <param name="capacity">Number of values in storage (at most 255).</param>
+	/// <param name="period">Seconds between points.</param>
+	/// <param name="scale">Value of one count, such as 0.01.</param>
+	CompactSeries(int16_t* storage, uint32_t* runTimes, uint8_t* runStarts,
+		unsigned int capacity, unsigned int period, float scale);
+
+	// Storage is not owned here, so only derived classes may copy.
+	CompactSeries(const CompactSeries&) = delete;
+
+	/// <summary>
+	/// Starts a run at the next point added. Each run holds at
+	/// least one point, so there is always room for it.
+	/// </summary>
+	void startRun(unsigned long time);
+
+public:
+
+	/// <summary>
+	/// Forward iterator from oldest to newest point. Points are
+	/// made on the fly, so they are given by value.
+	/// </summary>
+	class const_iterator {
+		const CompactSeries* _series;
+		unsigned int _index;
+	public:
+		/// <summary>
+		/// Holds a point for operator->.
+		/// </summary>
+		struct Arrow {
+			dataPoint dp;
+			const dataPoint* operator->() const { return &dp; }
+		};
+		const_iterator(const CompactSeries* series, unsigned int index) :
+			_series(series), _index(index) {}
+		dataPoint operator*() const { return (*_series)[_index]; }
+		Arrow operator->() const { return Arrow{ (*_series)[_index] }; }
+		const_iterator& operator++() { _index++; return *this; }
+		const_iterator operator++(int) { const_iterator it = *this; _index++; return it; }
+		bool operator==(const const_iterator& other) const { return _index == other._index; }
+		bool operator!=(const const_iterator& other) const { return _index != other._index; }
+	};
+
+	/// <summary>
+	/// Copies points from another series, keeping this scale.
+	/// If the source holds more points than this capacity,
+	/// only the newest are kept.
+	/// </summary>
+	/// <param name="other">Series to copy.</param>
+	CompactSeries& operator=(const CompactSeries& other);
+
+	/// <summary>
+	/// Adds a point after the newest. If the series is full,
+	/// the oldest point is overwritten.
+	/// </summary>
+	/// <param name="dp">Point to add.</param>
+	void push_back(const dataPoint& dp);
+
+	/// <summary>
+	/// Removes the oldest point, if any.
+	/// </summary>
+	void pop_front();
+
+	/// <summary>
+	/// Removes all points.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Returns point by age, where 0 is the oldest.
+	/// </summary>
+	/// <param name="index">Index from 0 to size() - 1.</param>
+	dataPoint operator[](unsigned int index) const;
+
+	/// <summary>
+	/// Sets the value of one count, and removes all points.
+	/// </summary>
+	/// <param name="scale">Value of one count, such as 0.01.</param>
+	void setScale(float scale);
+
+	dataPoint front() const { return (*this)[0]; }			// Oldest point.
+	dataPoint back() const { return (*this)[_count - 1]; }	// Newest point.
+
+	unsigned int size() const { return _count; }
+	unsigned int capacity() const { return _capacity; }
+	bool empty() const { return _count == 0; }
+	bool full() const { return _count == _capacity; }
+	unsigned int period() const { return _period; }
+	float scale() const { return _scale; }
+	unsigned int clamped() const { return _numClamped; }	// Values clamped since creation.
+
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, _count); }
+};
+
+/// <summary>
+/// Compact series with statically-sized storage for CAPACITY values.
+/// </summary>
+template <unsigned int CAPACITY>
+class FixedCompactSeries : public CompactSeries {
+
+	static_assert(CAPACITY <= 255, "CompactSeries holds at most 255 values.");
+
+	int16_t _storage[CAPACITY];
+	uint32_t _runTimeStorage[CAPACITY];
+	uint8_t _runStartStorage[CAPACITY];
+
+public:
+
+	/// <summary>
+	/// Creates an empty series.
+	/// </summary>
+	/// <param name="period">Seconds between points.</param>
+	/// <param name="scale">Value of one count, such as 0.01.</param>
+	FixedCompactSeries(unsigned int period, float scale = App_Settings::SERIES_SCALE_DEFAULT) :
+		CompactSeries(_storage, _runTimeStorage, _runStartStorage, CAPACITY, period, scale) {}
+
+	FixedCompactSeries(const FixedCompactSeries& other) :
+		CompactSeries(_storage, _runTimeStorage, _runStartStorage, CAPACITY, other._period, other._scale) {
+		CompactSeries::operator=(other);
+	}
+
+	FixedCompactSeries& operator=(const FixedCompactSeries& other) {
+		CompactSeries::operator=(other);
+		return *this;
+	}
+
+	using CompactSeries::operator=;		// From other capacities.
+};
+
+#endif
@@ -0,0 +1,99 @@
+// 
+// 
+// 
+
+#include "FastTrig.h"
+
+/// <summary>
+/// sin of 0-359 deg, generated with libm in double precision.
+/// </summary>
+const float FastTrig::SIN_DEG[360] = {
+	0.0f, 0.017452406f, 0.034899496f, 0.052335955f, 0.06975647f, 0.087155744f, 0.104528464f, 0.12186934f,	// 0-7
+	0.1391731f, 0.15643446f, 0.17364818f, 0.190809f, 0.20791169f, 0.22495106f, 0.2419219f, 0.25881904f,	// 8-15
+	0.27563736f, 0.2923717f, 0.309017f, 0.32556817f, 0.34202015f, 0.35836795f, 0.37460658f, 0.39073113f,	// 16-23
+	0.40673664f, 0.42261827f, 0.43837115f, 0.4539905f, 0.46947157f, 0.4848096f, 0.5f, 0.5150381f,	// 24-31
+	0.52991927f, 0.54463905f, 0.5591929f, 0.57357645f, 0.58778524f, 0.60181504f, 0.6156615f, 0.6293204f,	// 32-39
+	0.64278764f, 0.656059f, 0.6691306f, 0.6819984f, 0.6946584f, 0.70710677f, 0.7193398f, 0.7313537f,	// 40-47
+	0.7431448f, 0.7547096f, 0.76604444f, 0.777146f, 0.7880108f, 0.7986355f, 0.809017f, 0.81915206f,	// 48-55
+	0.82903755f, 0.83867055f, 0.8480481f, 0.8571673f, 0.8660254f, 0.8746197f, 0.88294756f, 0.8910065f,	// 56-63
+	0.89879405f, 0.9063078f, 0.9135454f, 0.92050487f, 0.92718387f, 0.9335804f, 0.9396926f, 0.94551855f,	// 64-71
+	0.95105654f, 0.9563047f, 0.9612617f, 0.9659258f, 0.9702957f, 0.97437006f, 0.9781476f, 0.98162717f,	// 72-79
+	0.9848077f, 0.98768836f, 0.99026805f, 0.99254614f, 0.9945219f, 0.9961947f, 0.9975641f, 0.9986295f,	// 80-87
+	0.99939084f, 0.9998477f, 1.0f, 0.9998477f, 0.99939084f, 0.9986295f, 0.9975641f, 0.9961947f,	// 88-95
+	0.9945219f, 0.99254614f, 0.99026805f, 0.98768836f, 0.9848077f, 0.98162717f, 0.9781476f, 0.97437006f,	// 96-103
+	0.9702957f, 0.9659258f, 0.9612617f, 0.9563047f, 0.95105654f, 0.94551855f, 0.9396926f, 0.9335804f,	// 104-111
+	0.92718387f, 0.92050487f, 0.9135454f, 0.9063078f, 0.89879405f, 0.8910065f, 0.88294756f, 0.8746197f,	// 112-119
+	0.8660254f, 0.8571673f, 0.8480481f, 0.83867055f, 0.82903755f, 0.81915206f, 0.809017f, 0.7986355f,	// 120-127
+	0.7880108f, 0.777146f, 0.76604444f, 0.7547096f, 0.7431448f, 0.7313537f, 0.7193398f, 0.70710677f,	// 128-135
+	0.6946584f, 0.6819984f, 0.6691306f, 0.656059f, 0.64278764f, 0.6293204f, 0.6156615f, 0.60181504f,	// 136-143
+	0.58778524f, 0.57357645f, 0.5591929f, 0.54463905f, 0.52991927f, 0.5150381f, 0.5f, 0.4848096f,	// 144-151
+	0.46947157f, 0.4539905f, 0.43837115f, 0.42261827f, 0.40673664f, 0.39073113f, 0.37460658f, 0.35836795f,	// 152-159
+	0.34202015f, 0.32556817f, 0.309017f, 0.2923717f, 0.27563736f, 0.25881904f, 0.2419219f, 0.22495106f,	// 160-167
+	0.20791169f, 0.190809f, 0.17364818f, 0.15643446f, 0.1391731f, 0.12186934f, 0.104528464f, 0.087155744f,	// 168-175
+	0.06975647f, 0.052335955f, 0.034899496f, 0.017452406f, 0.000000000f, -0.017452406f, -0.034899496f, -0.052335955f,	// 176-183
+	-0.06975647f, -0.087155744f, -0.104528464f, -0.12186934f, -0.1391731f, -0.15643446f, -0.17364818f, -0.190809f,	// 184-191
+	-0.20791169f, -0.22495106f, -0.2419219f, -0.25881904f, -0.27563736f, -0.2923717f, -0.309017f, -0.32556817f,	// 192-199
+	-0.34202015f, -0.35836795f, -0.37460658f, -0.39073113f, -0.40673664f, -0.42261827f, -0.43837115f, -0.4539905f,	// 200-207
+	-0.46947157f, -0.4848096f, -0.5f, -0.5150381f, -0.52991927f, -0.54463905f, -0.5591929f, -0.57357645f,	// 208-215
+	-0.58778524f, -0.60181504f, -0.6156615f, -0.6293204f, -0.64278764f, -0.656059f, -0.6691306f, -0.6819984f,	// 216-223
+	-0.6946584f, -0.70710677f, -0.7193398f, -0.7313537f, -0.7431448f, -0.7547096f, -0.76604444f, -0.777146f,	// 224-231
+	-0.7880108f, -0.7986355f, -0.809017f, -0.81915206f, -0.82903755f, -0.83867055f, -0.8480481f, -0.8571673f,	// 232-239
+	-0.8660254f, -0.8746197f, -0.88294756f, -0.8910065f, -0.89879405f, -0.9063078f, -0.9135454f, -0.92050487f,	// 240-247
+	-0.92718387f, -0.9335804f, -0.9396926f, -0.94551855f, -0.95105654f, -0.9563047f, -0.9612617f, -0.9659258f,	// 248-255
+	-0.9702957f, -0.97437006f, -0.9781476f, -0.98162717f, -0.9848077f, -0.98768836f, -0.99026805f, -0.99254614f,	// 256-263
+	-0.9945219f, -0.9961947f, -0.9975641f, -0.9986295f, -0.99939084f, -0.9998477f, -1.0f, -0.9998477f,	// 264-271
+	-0.99939084f, -0.9986295f, -0.9975641f, -0.9961947f, -0.9945219f, -0.99254614f, -0.99026805f, -0.98768836f,	// 272-279
+	-0.9848077f, -0.98162717f, -0.9781476f, -0.97437006f, -0.9702957f, -0.9659258f, -0.9612617f, -0.9563047f,	// 280-287
+	-0.95105654f, -0.94551855f, -0.9396926f, -0.9335804f, -0.92718387f, -0.92050487f, -0.9135454f, -0.9063078f,	// 288-295
+	-0.89879405f, -0.8910065f, -0.88294756f, -0.8746197f, -0.8660254f, -0.8571673f, -0.8480481f, -0.83867055f,	// 296-303
+	-0.82903755f, -0.81915206f, -0.809017f, -0.7986355f, -0.7880108f, -0.777146f, -0.76604444f, -0.7547096f,	// 304-311
+	-0.7431448f, -0.7313537f, -0.7193398f, -0.70710677f, -0.6946584f, -0.6819984f, -0.6691306f, -0.656059f,	// 312-319
+	-0.64278764f, -0.6293204f, -0.6156615f, -0.60181504f, -0.58778524f, -0.57357645f, -0.5591929f, -0.54463905f,	// 320-327
+	-0.52991927f, -0.5150381f, -0.5f, -0.4848096f, -0.46947157f, -0.4539905f, -0.43837115f, -0.42261827f,	// 328-335
+	-0.40673664f, -0.39073113f, -0.37460658f, -0.35836795f, -0.34202015f, -0.32556817f, -0.309017f, -0.2923717f,	// 336-343
+	-0.27563736f, -0.25881904f, -0.2419219f, -0.22495106f, -0.20791169f, -0.190809f, -0.17364818f, -0.15643446f,	// 344-351
+	-0.1391731f, -0.12186934f, -0.104528464f, -0.087155744f, -0.06975647f, -0.052335955f, -0.034899496f, -0.017452406f	// 352-359
+};
+
+/// <summary>
+/// Returns sin of an angle, deg, interpolated
+/// between whole degrees (error below 4e-5).
+/// </summary>
+float FastTrig::sinDeg(float degrees) {
+	float whole = floorf(degrees);
+	int index = wrapDeg((int)whole);
+	float lo = SIN_DEG[index];
+	float hi = SIN_DEG[(index == 359) ? 0 : index + 1];
+	return lo + (hi - lo) * (degrees - whole);
+}
+
+/// <summary>
+/// Returns cos of an angle, deg, interpolated
+/// between whole degrees (error below 4e-5).
+/// </summary>
+float FastTrig::cosDeg(float degrees) {
+	return sinDeg(degrees + 90);
+}
+
+/// <summary>
+/// Returns atan2(y, x), deg, from -180 to 180,
+/// by a polynomial (error below 0.1 deg).
+/// </summary>
+float FastTrig::atan2Deg(float y, float x) {
+	float ax = fabsf(x);
+	float ay = fabsf(y);
+	if (ax == 0 && ay == 0) {
+		return 0;
+	}
+	// atan of a ratio in [0, 1], then use symmetry for the octant.
+	bool isSteep = ay > ax;
+	float z = isSteep ? ax / ay : ay / ax;
+	float angle = z * (45 + (1 - z) * (14.02f + 3.799f * z));	// deg
+	if (isSteep) {
+		angle = 90 - angle;
+	}
+	if (x < 0) {
+		angle = 180 - angle;
+	}
+	return (y < 0) ? -angle : angle;
+}
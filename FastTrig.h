@@ -0,0 +1,60 @@
+// FastTrig.h
+
+#ifndef _FASTTRIG_h
+#define _FASTTRIG_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Sine and cosine by whole degree from a table in flash, and a
+/// fast atan2, for wind direction vector averaging. Readings are
+/// whole degrees (windAngleReading()), so the table is exact for
+/// them; other angles are interpolated. Each call is a few float
+/// operations, where libm works in double precision in software.
+/// </summary>
+namespace FastTrig {
+
+	extern const float SIN_DEG[360];	// sin of 0-359 deg.
+
+	/// <summary>
+	/// Returns an angle as 0-359 deg.
+	/// </summary>
+	inline int wrapDeg(int degrees) {
+		degrees %= 360;
+		return (degrees < 0) ? degrees + 360 : degrees;
+	}
+
+	/// <summary>
+	/// Returns sin of a whole angle, deg.
+	/// </summary>
+	inline float sinDeg(int degrees) { return SIN_DEG[wrapDeg(degrees)]; }
+
+	/// <summary>
+	/// Returns cos of a whole angle, deg.
+	/// </summary>
+	inline float cosDeg(int degrees) { return SIN_DEG[wrapDeg(degrees + 90)]; }
+
+	/// <summary>
+	/// Returns sin of an angle, deg, interpolated
+	/// between whole degrees (error below 4e-5).
+	/// </summary>
+	float sinDeg(float degrees);
+
+	/// <summary>
+	/// Returns cos of an angle, deg, interpolated
+	/// between whole degrees (error below 4e-5).
+	/// </summary>
+	float cosDeg(float degrees);
+
+	/// <summary>
+	/// Returns atan2(y, x), deg, from -180 to 180,
+	/// by a polynomial (error below 0.1 deg).
+	/// </summary>
+	float atan2Deg(float y, float x);
+}
+
+#endif
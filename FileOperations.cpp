@@ -69,20 +69,93 @@ void FileOperations::dirRemove(fs::FS& fs, const char* path) {
 /// </param>
 /// <returns>String containing file contents.</returns>
 String FileOperations::fileRead(fs::FS& fs, const char* path) {
+	String contents;
+	fileReadBlocks(fs, path,
+		[&contents](const char* block, size_t length) {
+			if (contents.length() == 0) {
+				contents.reserve(length);	// Most data files are one block.
+			}
+			return (bool)contents.concat(block, length);
+		});
+	return contents;
+}
 
+/// <summary>
+/// Reads a file in blocks of DATA_FILE_BUFFER_SIZE bytes and 
+/// passes each block to a callback.
+/// </summary>
+/// <param name="fs">File system to use.</param>
+/// <param name="path">Target file path.</param>
+/// <param name="onBlock">Called with each block read.</param>
+/// <returns>Number of bytes read, or -1 if file can't be opened.</returns>
+long FileOperations::fileReadBlocks(fs::FS& fs, const char* path, FileBlockCallback onBlock) {
+	File file = fs.open(path, FILE_READ);
+	if (!file) {
+		Serial.printf("ERROR: fileRead failed to open %s for reading\n", path);
+		return -1;
+	}
+	char block[DATA_FILE_BUFFER_SIZE];
+	long total = 0;
+	size_t n;
+	while ((n = file.read((uint8_t*)block, sizeof(block))) > 0) {
+		total += n;
+		if (!onBlock(block, n)) {
+			break;
+		}
+	}
+	file.close();
+	return total;
+}
+
+/// <summary>
+/// Reads a file into a caller-provided buffer and 
+/// null-terminates it. Reads at most bufferSize - 1 bytes; 
+/// a longer file is truncated with an error message.
+/// </summary>
+/// <param name="fs">File system to use.</param>
+/// <param name="path">Target file path.</param>
+/// <param name="buffer">Buffer to fill.</param>
+/// <param name="bufferSize">Size of buffer, including terminator.</param>
+/// <returns>Number of bytes read, or -1 if file can't be opened.</returns>
+long FileOperations::fileReadInto(fs::FS& fs, const char* path, char* buffer, size_t bufferSize) {
+	if (bufferSize == 0) {
+		return 0;
+	}
 	File file = fs.open(path, FILE_READ);
 	if (!file) {
-		Serial.println("ERROR: fileRead failed to open file for reading");
-		return "";
+		Serial.printf("ERROR: fileRead failed to open %s for reading\n", path);
+		buffer[0] = '\0';
+		return -1;
+	}
+	size_t n = file.read((uint8_t*)buffer, bufferSize - 1);
+	buffer[n] = '\0';
+	if (file.available() > 0) {
+		Serial.printf("ERROR: fileReadInto truncated %s at %u bytes\n", path, (unsigned int)n);
 	}
-	char stringC[DATA_FILE_BUFFER_SIZE] = {  };	// C-string array to hold values from stream.
-	int i = 0;
-	while (file.available()) {
-		stringC[i] += file.read();	// Add each character to C-string.
-		i++;
+	file.close();
+	return n;
+}
+
+/// <summary>
+/// Reads a whole file into a std::string, sized once 
+/// from the file size.
+/// </summary>
+/// <param name="fs">File system to use.</param>
+/// <param name="path">Target file path.</param>
+/// <param name="target">String to replace with file contents.</param>
+/// <returns>True on success.</returns>
+bool FileOperations::fileReadInto(fs::FS& fs, const char* path, std::string& target) {
+	target.clear();
+	File file = fs.open(path, FILE_READ);
+	if (!file) {
+		Serial.printf("ERROR: fileRead failed to open %s for reading\n", path);
+		return false;
 	}
+	target.resize(file.size());
+	size_t n = file.read((uint8_t*)&target[0], target.size());
+	target.resize(n);
 	file.close();
-	return String(stringC);
+	return true;
 }
 
 
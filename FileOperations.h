@@ -19,6 +19,9 @@ used with both SD cards and LittleFS.
 #include <LittleFS.h>
 #include "App_Settings.h"
 
+#include <functional>
+#include <string>
+
 using namespace App_Settings;
 
 /// <summary>
@@ -47,6 +50,44 @@ namespace FileOperations {
 	/// <returns>String containing file contents.</returns>
 	String fileRead(fs::FS& fs, const char* path);
 
+	/// <summary>
+	/// Called with each block of a file as it is read. Return 
+	/// false to stop reading.
+	/// </summary>
+	typedef std::function<bool(const char* block, size_t length)> FileBlockCallback;
+
+	/// <summary>
+	/// Reads a file in blocks of DATA_FILE_BUFFER_SIZE bytes and 
+	/// passes each block to a callback.
+	/// </summary>
+	/// <param name="fs">File system to use.</param>
+	/// <param name="path">Target file path.</param>
+	/// <param name="onBlock">Called with each block read.</param>
+	/// <returns>Number of bytes read, or -1 if file can't be opened.</returns>
+	long fileReadBlocks(fs::FS& fs, const char* path, FileBlockCallback onBlock);
+
+	/// <summary>
+	/// Reads a file into a caller-provided buffer and 
+	/// null-terminates it. Reads at most bufferSize - 1 bytes; 
+	/// a longer file is truncated with an error message.
+	/// </summary>
+	/// <param name="fs">File system to use.</param>
+	/// <param name="path">Target file path.</param>
+	/// <param name="buffer">Buffer to fill.</param>
+	/// <param name="bufferSize">Size of buffer, including terminator.</param>
+	/// <returns>Number of bytes read, or -1 if file can't be opened.</returns>
+	long fileReadInto(fs::FS& fs, const char* path, char* buffer, size_t bufferSize);
+
+	/// <summary>
+	/// Reads a whole file into a std::string, sized once 
+	/// from the file size.
+	/// </summary>
+	/// <param name="fs">File system to use.</param>
+	/// <param name="path">Target file path.</param>
+	/// <param name="target">String to replace with file contents.</param>
+	/// <returns>True on success.</returns>
+	bool fileReadInto(fs::FS& fs, const char* path, std::string& target);
+
 	void fileRename(fs::FS& fs, const char* path1, const char* path2);
 
 	void fileDelete(fs::FS& fs, const char* path);
@@ -18,9 +18,24 @@ using std::string;
 /// <param name="targetList">List of dataPoints to add to.</param>
 /// <param name="dp">dataPoint to add.</param>
 /// <param name="numElements">Maximum allowed elements in list.</param>
-void ListFunctions::addToList(list<dataPoint>& targetList, dataPoint dp, int numElements) {
-	targetList.push_back(dp);		// Add to list (raw).
-	if (targetList.size() > numElements) {
+void ListFunctions::addToList(RingBuffer<dataPoint>& targetList, dataPoint dp, int numElements) {
+	targetList.push_back(dp);		// Add to list (overwrites oldest when full).
+	while (targetList.size() > numElements) {
+		targetList.pop_front();		// If too many, remove the first.
+	}
+}
+
+/// <summary>
+/// Adds dataPoint to a compact list and limits list size. 
+/// (If adding creates too many elements, the first element 
+/// is removed.)
+/// </summary>
+/// <param name="targetList">Compact list of dataPoints to add to.</param>
+/// <param name="dp">dataPoint to add.</param>
+/// <param name="numElements">Maximum allowed elements in list.</param>
+void ListFunctions::addToList(CompactSeries& targetList, dataPoint dp, int numElements) {
+	targetList.push_back(dp);		// Add to list (overwrites oldest when full).
+	while (targetList.size() > numElements) {
 		targetList.pop_front();		// If too many, remove the first.
 	}
 }
@@ -32,9 +47,9 @@ void ListFunctions::addToList(list<dataPoint>& targetList, dataPoint dp, int num
 /// <param name="targetList">List of values to add to.</param>
 /// <param name="val">Value to add.</param>
 /// <param name="numElements">Maximum allowed elements in list.</param>
-void ListFunctions::addToList(list<float>& targetList, float val, int numElements) {
-	targetList.push_back(val);		// Add value to list.
-	if (targetList.size() > numElements) {
+void ListFunctions::addToList(RingBuffer<float>& targetList, float val, int numElements) {
+	targetList.push_back(val);		// Add value to list (overwrites oldest when full).
+	while (targetList.size() > numElements) {
 		targetList.pop_front();		// If too many, remove the first.
 	}
 }
@@ -47,23 +62,25 @@ void ListFunctions::addToList(list<float>& targetList, float val, int numElement
 /// The list of dataPoint to average.</param>
 /// <param name="numToAverage">
 /// The number of elements at the end of the list to average.
+/// NaN (missing) values are skipped.
 /// </param>
-/// <returns>Average value.</returns>
-float ListFunctions::listAverage(list<dataPoint>& targetList, int numToAverage) {
+/// <returns>Average value, or NaN if no values.</returns>
+float ListFunctions::listAverage(SeriesView targetList, int numToAverage) {
 	// Ensure we don't iterate past the first element.
 	if (numToAverage > targetList.size()) {
 		numToAverage = targetList.size();
 	}
-	// Iterate through the last (most recent) elements.
-	auto it = targetList.rbegin();	// Reverse iterator to last element.
+	// Sum the last (most recent) elements.
 	float total = 0;
-	for (int i = 0; i < numToAverage; i++)
+	int numValues = 0;
+	for (unsigned int i = targetList.size() - numToAverage; i < targetList.size(); i++)
 	{
-		dataPoint dp = *it;
-		total += dp.value;
-		it++;
+		if (!isnan(targetList[i].value)) {
+			total += targetList[i].value;
+			numValues++;
+		}
 	}
-	return total / numToAverage;
+	return (numValues > 0) ? total / numValues : NAN;
 }
 
 /// <summary>
@@ -76,18 +93,16 @@ float ListFunctions::listAverage(list<dataPoint>& targetList, int numToAverage)
 /// The number of elements at the end of the list to average.
 /// </param>
 /// <returns>Average value.</returns>
-float ListFunctions::listAverage(list<float>& targetList, int numToAverage) {
+float ListFunctions::listAverage(const RingBuffer<float>& targetList, int numToAverage) {
 	// Ensure we don't iterate past the first element.
 	if (numToAverage > targetList.size()) {
 		numToAverage = targetList.size();
 	}
-	// Iterate through the last (most recent) elements.
-	auto it = targetList.rbegin();	// Reverse iterator to last element.
+	// Sum the last (most recent) elements.
 	float total = 0;
-	for (int i = 0; i < numToAverage; i++)
+	for (unsigned int i = targetList.size() - numToAverage; i < targetList.size(); i++)
 	{
-		total += *it;
-		it++;
+		total += targetList[i];
 	}
 	return total / numToAverage;
 }
@@ -98,25 +113,44 @@ float ListFunctions::listAverage(list<float>& targetList, int numToAverage) {
 /// <param name="targetList">List of dataPoint to check.</param>
 /// <param name="numElements">Number of elements to check, starting from end.</param>
 /// <returns>Largest value of a list</returns>
-float ListFunctions::listMaximum(list<dataPoint>& targetList, int numElements) {
+float ListFunctions::listMaximum(SeriesView targetList, int numElements) {
 	// Ensure we don't iterate past the first element.
 	if (numElements > targetList.size()) {
 		numElements = targetList.size();
 	}
-	// Iterate through the last (most recent) elements.
-	auto it = targetList.rbegin();	// Reverse iterator to last element.
 	// Start with low value we should never see.
 	float maxItem = -999999999;
-	for (int i = 1; i < numElements + 1; i++) {
-		dataPoint dp = *it;
-		if (dp.value > maxItem) {
-			maxItem = dp.value;
+	// Check the last (most recent) elements.
+	for (unsigned int i = targetList.size() - numElements; i < targetList.size(); i++) {
+		if (targetList[i].value > maxItem) {
+			maxItem = targetList[i].value;
 		}
-		it++;	// next item.
 	}
 	return maxItem;
 }
 
+/// <summary>
+/// Returns the smallest value of a list of dataPoint from the last numElements.
+/// </summary>
+/// <param name="targetList">List of dataPoint to check.</param>
+/// <param name="numElements">Number of elements to check, starting from end.</param>
+/// <returns>Smallest value of a list</returns>
+float ListFunctions::listMinimum(SeriesView targetList, int numElements) {
+	// Ensure we don't iterate past the first element.
+	if (numElements > targetList.size()) {
+		numElements = targetList.size();
+	}
+	// Start with high value we should never see.
+	float minItem = 999999999;
+	// Check the last (most recent) elements.
+	for (unsigned int i = targetList.size() - numElements; i < targetList.size(); i++) {
+		if (targetList[i].value < minItem) {
+			minItem = targetList[i].value;
+		}
+	}
+	return minItem;
+}
+
 /// <summary>
 /// Converts a list of data points to a string of "time, value" 
 /// pairs, each delimited by "," separate points delimited by 
@@ -124,13 +158,12 @@ float ListFunctions::listMaximum(list<dataPoint>& targetList, int numElements) {
 /// </summary>
 /// <param name="targetList">List of dataPoint.</param>
 /// <returns>Delimited string of multiple (time, value) data points.</returns>
-String ListFunctions::listToString_data(list<dataPoint>& targetList) {
+String ListFunctions::listToString_data(SeriesView targetList) {
 	String s = "";
 	if (targetList.size() == 0) {
 		return s + "[-EMPTY-]";
 	}
-	dataPoint dp{};
-	for (list<dataPoint>::iterator it = targetList.begin(); it != targetList.end(); ++it) {
+	for (SeriesView::const_iterator it = targetList.begin(); it != targetList.end(); ++it) {
 		// Output each dataPoint as CSV separated by "~".
 		s += String(it->time) + ",";
 		s += String(it->value) + "~";
@@ -149,7 +182,7 @@ String ListFunctions::listToString_data(list<dataPoint>& targetList) {
 /// <returns>
 /// Comma-separated "time,value" pairs delimited by "~"</returns>
 String ListFunctions::listToString_data(
-	list<dataPoint>& targetList,
+	SeriesView targetList,
 	bool isConvertZeroToEmpty,
 	unsigned int decimalPlaces)
 {
@@ -157,7 +190,7 @@ String ListFunctions::listToString_data(
 	if (targetList.size() == 0) {
 		return s + "[-EMPTY-]";
 	}
-	for (list<dataPoint>::iterator it = targetList.begin(); it != targetList.end(); ++it) {
+	for (SeriesView::const_iterator it = targetList.begin(); it != targetList.end(); ++it) {
 		dataPoint dp = *it;
 		s += String(dp.time) + ",";
 		if (isConvertZeroToEmpty && dp.value == 0)
@@ -186,8 +219,8 @@ String ListFunctions::listToString_data(
 /// <returns>Two String lists, respectively delimited by "|".
 /// </returns>
 String ListFunctions::listToString_data(
-	list<dataPoint>& targetList_hi,
-	list<dataPoint>& targetList_lo,
+	SeriesView targetList_hi,
+	SeriesView targetList_lo,
 	bool isConvertZeroToEmpty,
 	unsigned int decimalPlaces)
 {
@@ -233,34 +266,35 @@ list<String> ListFunctions::splitString(const String& str, const char delim) {
 }
 
 /// <summary>
-/// Returns a list of dataPoints retrieved from a delimited 
-/// string of comma-separated "time,value" pairs.
+/// Fills a list with dataPoints retrieved from a delimited 
+/// string of comma-separated "time,value" pairs. Fields 
+/// without a numeric time (such as "[-EMPTY-]") are skipped.
 /// </summary>
 /// <param name="str">Delimited string of dataPoints.</param>
-/// <returns>
-/// List of "time,value" dataPoints retrieved from a delimited string.
-/// </returns>
-list<dataPoint> ListFunctions::listData_fromString(String& str) {
-	list<dataPoint> dPoints;		// List to hold data points.
-	std::istringstream ss(str.c_str());
-	while (!ss.eof()) {
-		std::string sub;			// empty string to hold substrings
-		std::getline(ss, sub, '~');	// Read next delimited field into sub.
-		// Convert string to data point and add to list.
-		size_t i = sub.find_first_of(",");
-		float val = 0;
-		std::string s = sub.substr(i + 1);
-		// Replace empty values with zero.
-		if (!s.empty()) {
-			val = std::stof(s);
+/// <param name="targetList">List to clear and fill.</param>
+void ListFunctions::listData_fromString(const String& str, RingBuffer<dataPoint>& targetList) {
+	targetList.clear();
+	const char* field = str.c_str();
+	while (*field != '\0') {
+		// Convert "time,value" field to data point and add to list.
+		char* end;
+		unsigned long time = strtoul(field, &end, 10);
+		if (end != field && *end == ',') {
+			const char* valStart = end + 1;
+			// Replace empty values with zero.
+			float val = strtof(valStart, &end);
+			if (end == valStart) {
+				val = 0;
+			}
+			targetList.push_back(dataPoint(time, val));
 		}
-		else {
-			val = 0;
+		// Advance to next delimited field.
+		field = strchr(field, '~');
+		if (field == nullptr) {
+			break;
 		}
-		dataPoint dp = dataPoint(std::stoul(sub.substr(0, i)), val);
-		dPoints.push_back(dp);
+		field++;
 	}
-	return dPoints;
 }
 
 void ListFunctions::listPrint(list<std::string> targetList) {
@@ -279,9 +313,9 @@ void ListFunctions::listPrint(list<String> targetList) {
 	}
 }
 
-void ListFunctions::listPrint(list<dataPoint> targetList) {
+void ListFunctions::listPrint(SeriesView targetList) {
 	Serial.println("List elements:");
-	for (list<dataPoint>::iterator it = targetList.begin(); it != targetList.end(); ++it) {
+	for (SeriesView::const_iterator it = targetList.begin(); it != targetList.end(); ++it) {
 		dataPoint dp = *it;
 		Serial.println("(" + String(dp.time) + ", " + String(dp.value) + ")");
 	}
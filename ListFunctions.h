@@ -10,6 +10,8 @@
 #endif
 
 #include "dataPoint.h"
+#include "RingBuffer.h"
+#include "SeriesView.h"
 
 #include <list>
 using std::list;
@@ -26,7 +28,17 @@ namespace ListFunctions {
 	/// <param name="targetList">List of dataPoints to add to.</param>
 	/// <param name="dp">dataPoint to add.</param>
 	/// <param name="numElements">Maximum allowed elements in list.</param>
-	void addToList(list<dataPoint>& targetList, dataPoint val, int numElements);
+	void addToList(RingBuffer<dataPoint>& targetList, dataPoint val, int numElements);
+
+	/// <summary>
+	/// Adds dataPoint to a compact list and limits list size. 
+	/// (If adding creates too many elements, the first element 
+	/// is removed.)
+	/// </summary>
+	/// <param name="targetList">Compact list of dataPoints to add to.</param>
+	/// <param name="dp">dataPoint to add.</param>
+	/// <param name="numElements">Maximum allowed elements in list.</param>
+	void addToList(CompactSeries& targetList, dataPoint val, int numElements);
 
 	/// <summary>
 	/// Adds values to list and limits list size. (If adding 
@@ -35,7 +47,7 @@ namespace ListFunctions {
 	/// <param name="targetList">List of values to add to.</param>
 	/// <param name="val">Value to add.</param>
 	/// <param name="numElements">Maximum allowed elements in list.</param>
-	void addToList(list<float>& targetList, float val, int numElements);
+	void addToList(RingBuffer<float>& targetList, float val, int numElements);
 
 	/// <summary>
 	/// Returns the average of the last values of members 
@@ -47,7 +59,7 @@ namespace ListFunctions {
 	/// The number of elements at the end of the list to average.
 	/// </param>
 	/// <returns>Average value.</returns>
-	float listAverage(list<dataPoint>& targetList, int numElements);
+	float listAverage(SeriesView targetList, int numElements);
 
 	/// <summary>
 	/// Returns the average of the last values of members 
@@ -59,7 +71,7 @@ namespace ListFunctions {
 	/// The number of elements at the end of the list to average.
 	/// </param>
 	/// <returns>Average value.</returns>
-	float listAverage(list<float>& targetList, int numElements);
+	float listAverage(const RingBuffer<float>& targetList, int numElements);
 
 	/// <summary>
 	/// Returns the largest value of a list of dataPoints 
@@ -68,7 +80,16 @@ namespace ListFunctions {
 	/// <param name="targetList">List of dataPoint to check.</param>
 	/// <param name="numElements">Number of elements to check, starting from end.</param>
 	/// <returns>Largest value of a list</returns>
-	float listMaximum(list<dataPoint>& targetList, int numElements);
+	float listMaximum(SeriesView targetList, int numElements);
+
+	/// <summary>
+	/// Returns the smallest value of a list of dataPoints 
+	/// from the last numElements.
+	/// </summary>
+	/// <param name="targetList">List of dataPoint to check.</param>
+	/// <param name="numElements">Number of elements to check, starting from end.</param>
+	/// <returns>Smallest value of a list</returns>
+	float listMinimum(SeriesView targetList, int numElements);
 
 	/// <summary>
 /// Converts a list of data points to a string of "time, value" 
@@ -77,7 +98,7 @@ namespace ListFunctions {
 /// </summary>
 /// <param name="targetList">List of dataPoint.</param>
 /// <returns>Delimited string of multiple (time, value) data points.</returns>
-	String listToString_data(list<dataPoint>& targetList);
+	String listToString_data(SeriesView targetList);
 
 	/// <summary>
 	/// Converts a list of dataPoints to a string of 
@@ -91,7 +112,7 @@ namespace ListFunctions {
 	/// <returns>
 	/// Comma-separated "time,value" pairs delimited by "~"</returns>
 	String listToString_data(
-		list<dataPoint>& targetList,
+		SeriesView targetList,
 		bool isConvertZeroToEmpty,
 		unsigned int decimalPlaces);
 
@@ -110,8 +131,8 @@ namespace ListFunctions {
 	/// Decimal places to display.</param>
 	/// <returns>Two String lists, respectively delimited by "|".</returns>
 	String listToString_data(
-		list<dataPoint>& targetList_hi,
-		list<dataPoint>& targetList_lo,
+		SeriesView targetList_hi,
+		SeriesView targetList_lo,
 		bool isConvertZeroToEmpty,
 		unsigned int decimalPlaces);
 
@@ -141,14 +162,14 @@ namespace ListFunctions {
 	list<String> splitString(const String& str, const char delimiter);
 
 	/// <summary>
-	/// Returns a list of dataPoints retrieved from a delimited 
-	/// string of comma-separated "time,value" pairs.
+	/// Fills a list with dataPoints retrieved from a delimited 
+	/// string of comma-separated "time,value" pairs. Fields 
+	/// without a numeric time are skipped. If the string holds 
+	/// more points than the list capacity, the newest are kept.
 	/// </summary>
 	/// <param name="str">Delimited string of dataPoints.</param>
-	/// <returns>
-	/// List of "time,value" dataPoints retrieved from a delimited string.
-	/// </returns>
-	list<dataPoint> listData_fromString(String& str);
+	/// <param name="targetList">List to clear and fill.</param>
+	void listData_fromString(const String& str, RingBuffer<dataPoint>& targetList);
 
 	/// <summary>
 	/// Prints out the elements of a list of C++ std::string.
@@ -166,7 +187,7 @@ namespace ListFunctions {
 	/// Prints out the (time, value) elements of a list of datPoint.
 	/// </summary>
 	/// <param name="targetList">The list to print.</param>
-	void listPrint(list<dataPoint> targetList);
+	void listPrint(SeriesView targetList);
 
 };
 
@@ -0,0 +1,106 @@
+// 
+// 
+// 
+
+#include "LogBuffer.h"
+
+/// <summary>
+/// Creates an empty log buffer.
+/// </summary>
+/// <param name="capacity">Size of buffer, bytes.</param>
+LogBuffer::LogBuffer(size_t capacity) {
+	_buffer = new char[capacity];
+	_capacity = capacity;
+}
+
+/// <summary>
+/// Adds text to the buffer, or drops it if it does not fit.
+/// </summary>
+/// <param name="text">Text to add.</param>
+/// <param name="length">Length of text.</param>
+/// <returns>True if text was added.</returns>
+bool LogBuffer::write(const char* text, size_t length) {
+	portENTER_CRITICAL(&_mux);
+	if (length > _capacity - _count) {
+		_droppedBytes += length;
+		portEXIT_CRITICAL(&_mux);
+		return false;
+	}
+	if (_count == 0) {
+		_oldestMillis = millis();
+	}
+	size_t tail = (_head + _count) % _capacity;
+	size_t first = _capacity - tail;	// Room before wrapping.
+	if (first > length) {
+		first = length;
+	}
+	memcpy(_buffer + tail, text, first);
+	memcpy(_buffer, text + first, length - first);
+	_count += length;
+	portEXIT_CRITICAL(&_mux);
+	return true;
+}
+
+/// <summary>
+/// Copies the oldest text into a buffer, without removing it.
+/// </summary>
+/// <param name="buffer">Buffer to fill.</param>
+/// <param name="maxLen">Size of buffer.</param>
+/// <returns>Number of chars copied.</returns>
+size_t LogBuffer::peek(char* buffer, size_t maxLen) const {
+	portENTER_CRITICAL(&_mux);
+	size_t length = (_count < maxLen) ? _count : maxLen;
+	size_t first = _capacity - _head;	// Chars before wrapping.
+	if (first > length) {
+		first = length;
+	}
+	memcpy(buffer, _buffer + _head, first);
+	memcpy(buffer + first, _buffer, length - first);
+	portEXIT_CRITICAL(&_mux);
+	return length;
+}
+
+/// <summary>
+/// Removes the oldest chars, after they have been written.
+/// Any text still held keeps the age of the oldest removed,
+/// so it is flushed no later than before.
+/// </summary>
+/// <param name="length">Number of chars to remove.</param>
+void LogBuffer::consume(size_t length) {
+	portENTER_CRITICAL(&_mux);
+	if (length > _count) {
+		length = _count;
+	}
+	_head = (_head + length) % _capacity;
+	_count -= length;
+	portEXIT_CRITICAL(&_mux);
+}
+
+/// <summary>
+/// Returns the count of dropped chars and resets it to zero.
+/// </summary>
+unsigned long LogBuffer::takeDroppedBytes() {
+	portENTER_CRITICAL(&_mux);
+	unsigned long dropped = _droppedBytes;
+	_droppedBytes = 0;
+	portEXIT_CRITICAL(&_mux);
+	return dropped;
+}
+
+/// <summary>
+/// Returns milliseconds since the oldest held text was written,
+/// or 0 if empty.
+/// </summary>
+unsigned long LogBuffer::ageMillis() const {
+	portENTER_CRITICAL(&_mux);
+	unsigned long age = (_count > 0) ? millis() - _oldestMillis : 0;
+	portEXIT_CRITICAL(&_mux);
+	return age;
+}
+
+size_t LogBuffer::size() const {
+	portENTER_CRITICAL(&_mux);
+	size_t count = _count;
+	portEXIT_CRITICAL(&_mux);
+	return count;
+}
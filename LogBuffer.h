@@ -0,0 +1,75 @@
+// LogBuffer.h
+
+#ifndef _LOGBUFFER_h
+#define _LOGBUFFER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Fixed-size ring of text waiting to be written to a log file.
+/// Any task may write; one flusher copies text out with peek()
+/// and removes it with consume() once it is safely written.
+/// A write that does not fit is dropped whole and counted,
+/// so the log never holds a partial line.
+/// </summary>
+class LogBuffer {
+
+	char* _buffer;					// Ring storage (allocated once).
+	size_t _capacity;				// Size of _buffer.
+	size_t _head = 0;				// Index of oldest char.
+	size_t _count = 0;				// Chars held.
+	unsigned long _oldestMillis = 0;// millis() when oldest held text was written.
+	unsigned long _droppedBytes = 0;// Chars dropped because buffer was full.
+	mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+
+public:
+
+	/// <summary>
+	/// Creates an empty log buffer.
+	/// </summary>
+	/// <param name="capacity">Size of buffer, bytes.</param>
+	LogBuffer(size_t capacity);
+
+	/// <summary>
+	/// Adds text to the buffer, or drops it if it does not fit.
+	/// </summary>
+	/// <param name="text">Text to add.</param>
+	/// <param name="length">Length of text.</param>
+	/// <returns>True if text was added.</returns>
+	bool write(const char* text, size_t length);
+
+	/// <summary>
+	/// Copies the oldest text into a buffer, without removing it.
+	/// </summary>
+	/// <param name="buffer">Buffer to fill.</param>
+	/// <param name="maxLen">Size of buffer.</param>
+	/// <returns>Number of chars copied.</returns>
+	size_t peek(char* buffer, size_t maxLen) const;
+
+	/// <summary>
+	/// Removes the oldest chars, after they have been written.
+	/// </summary>
+	/// <param name="length">Number of chars to remove.</param>
+	void consume(size_t length);
+
+	/// <summary>
+	/// Returns the count of dropped chars and resets it to zero.
+	/// </summary>
+	unsigned long takeDroppedBytes();
+
+	/// <summary>
+	/// Returns milliseconds since the oldest held text was written,
+	/// or 0 if empty.
+	/// </summary>
+	unsigned long ageMillis() const;
+
+	size_t size() const;
+	size_t capacity() const { return _capacity; }
+	bool empty() const { return size() == 0; }
+};
+
+#endif
@@ -0,0 +1,100 @@
+// 
+// 
+// 
+
+#include "PageCache.h"
+#include "FileOperations.h"
+
+static const unsigned int MAX_PLACEHOLDER_LENGTH = 32;	// TEMPLATE_PARAM_NAME_LENGTH of ESPAsyncWebServer.
+
+/// <summary>
+/// Returns a page rendered in the current epoch, rendering
+/// it from its file if needed.
+/// </summary>
+/// <param name="path">File path, such as "/html/sensors.html".</param>
+/// <param name="processor">Placeholder processor.</param>
+/// <returns>Page, or nullptr if the file could not be read
+/// or the cache is full.</returns>
+const PageCache::Page* PageCache::get(const char* path, Processor processor) {
+	uint32_t epoch = _epoch;
+	Page* page = nullptr;
+	for (Page& cached : _pages) {
+		if (cached.path == path) {
+			page = &cached;
+			break;
+		}
+		if (page == nullptr && cached.path.length() == 0) {
+			page = &cached;		// First unused slot, if path not cached.
+		}
+	}
+	if (page == nullptr) {
+		Serial.printf("ERROR: PageCache is full; %s not cached.\n", path);
+		return nullptr;
+	}
+	if (page->path == path && page->epoch == epoch) {
+		_hits++;
+		return page;
+	}
+
+	String text = FileOperations::fileRead(_fs, path);
+	if (text.length() == 0) {
+		return nullptr;
+	}
+	page->path = path;
+	page->epoch = epoch;
+	page->body = render(text, processor);
+	page->etag = etagOf(page->body);
+	_renders++;
+	return page;
+}
+
+/// <summary>
+/// Replaces %NAME% placeholders in a page as the async web
+/// server does: a name is at most 32 chars, "%%" is a "%",
+/// and a "%" with no closing "%" in reach is left as it is.
+/// </summary>
+/// <param name="page">Page text.</param>
+/// <param name="processor">Placeholder processor.</param>
+/// <returns>Rendered page.</returns>
+String PageCache::render(const String& page, Processor processor) {
+	String out;
+	out.reserve(page.length() + page.length() / 4);
+	unsigned int start = 0;
+	while (start < page.length()) {
+		int open = page.indexOf('%', start);
+		if (open < 0) {
+			break;
+		}
+		out += page.substring(start, open);
+		int close = page.indexOf('%', open + 1);
+		if (close < 0 || (unsigned int)(close - open - 1) > MAX_PLACEHOLDER_LENGTH) {
+			out += '%';		// Not a placeholder.
+			start = open + 1;
+			continue;
+		}
+		if (close == open + 1) {
+			out += '%';		// "%%" is an escaped "%".
+		}
+		else {
+			out += processor(page.substring(open + 1, close));
+		}
+		start = close + 1;
+	}
+	out += page.substring(start);
+	return out;
+}
+
+/// <summary>
+/// Returns a quoted ETag for a page's text (32-bit FNV-1a hash,
+/// with the length so equal hashes of different pages are rarer).
+/// </summary>
+String PageCache::etagOf(const String& body) {
+	uint32_t hash = 2166136261UL;
+	const char* c = body.c_str();
+	for (unsigned int i = 0; i < body.length(); i++) {
+		hash = (hash ^ (uint8_t)c[i]) * 16777619UL;
+	}
+	char etag[24];
+	snprintf(etag, sizeof(etag), "\"%08x-%x\"", (unsigned int)hash, body.length());
+	return String(etag);
+}
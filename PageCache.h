@@ -0,0 +1,103 @@
+// PageCache.h
+
+#ifndef _PAGECACHE_h
+#define _PAGECACHE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <FS.h>
+#include <functional>
+#include "App_Settings.h"
+
+/// <summary>
+/// Html pages with their %PLACEHOLDER% elements already replaced,
+/// held in RAM. Placeholder values only change when sensors are
+/// read, so a page is rendered at most once per reading epoch:
+/// invalidate() starts a new epoch after each readSensors(), and
+/// the next get() of a page renders it again.
+/// Each page has an ETag (a hash of its text), so a browser that
+/// already has the page is answered with 304 Not Modified.
+/// get() is called only from the web server's task; invalidate()
+/// may be called from any task.
+/// </summary>
+class PageCache {
+
+public:
+
+	/// <summary>
+	/// Returns the String substituted for a placeholder
+	/// (same as the web server's AwsTemplateProcessor).
+	/// </summary>
+	typedef std::function<String(const String& var)> Processor;
+
+	/// <summary>
+	/// A rendered page.
+	/// </summary>
+	struct Page {
+		String path;			// File path, or empty if slot unused.
+		uint32_t epoch = 0;		// Reading epoch when rendered.
+		String body;			// Page with placeholders replaced.
+		String etag;			// Quoted hash of body.
+	};
+
+	/// <summary>
+	/// Creates an empty cache of pages in a file system.
+	/// </summary>
+	/// <param name="fs">File system holding the page templates.</param>
+	PageCache(fs::FS& fs) : _fs(fs) {}
+
+	/// <summary>
+	/// Returns a page rendered in the current epoch, rendering
+	/// it from its file if needed.
+	/// </summary>
+	/// <param name="path">File path, such as "/html/sensors.html".</param>
+	/// <param name="processor">Placeholder processor.</param>
+	/// <returns>Page, or nullptr if the file could not be read
+	/// or the cache is full.</returns>
+	const Page* get(const char* path, Processor processor);
+
+	/// <summary>
+	/// Starts a new reading epoch, so pages are rendered again.
+	/// </summary>
+	void invalidate() { _epoch++; }
+
+	/// <summary>
+	/// Returns the current reading epoch.
+	/// </summary>
+	uint32_t epoch() const { return _epoch; }
+
+	/// <summary>
+	/// Returns the number of renders and of gets served from RAM.
+	/// </summary>
+	unsigned long renders() const { return _renders; }
+	unsigned long hits() const { return _hits; }
+
+	/// <summary>
+	/// Replaces %NAME% placeholders in a page as the async web
+	/// server does: a name is at most 32 chars, "%%" is a "%",
+	/// and a "%" with no closing "%" in reach is left as it is.
+	/// </summary>
+	/// <param name="page">Page text.</param>
+	/// <param name="processor">Placeholder processor.</param>
+	/// <returns>Rendered page.</returns>
+	static String render(const String& page, Processor processor);
+
+	/// <summary>
+	/// Returns a quoted ETag for a page's text.
+	/// </summary>
+	static String etagOf(const String& body);
+
+private:
+
+	fs::FS& _fs;							// File system of page templates.
+	Page _pages[App_Settings::PAGE_CACHE_SIZE];	// Cached pages.
+	volatile uint32_t _epoch = 1;			// Reading epoch (0 is never current).
+	unsigned long _renders = 0;				// Pages rendered.
+	unsigned long _hits = 0;				// Pages served without rendering.
+};
+
+#endif
@@ -0,0 +1,154 @@
+// 
+// 
+// 
+
+#include "PhaseTimer.h"
+
+/// <summary>
+/// Returns the index of the bucket for a duration.
+/// </summary>
+unsigned int PhaseHistogram::bucketIndex(uint32_t us) {
+	unsigned int index = (us == 0) ? 0 : 32 - __builtin_clz(us);	// Bits needed.
+	return (index < NUM_BUCKETS) ? index : NUM_BUCKETS - 1;
+}
+
+/// <summary>
+/// Adds a duration.
+/// </summary>
+/// <param name="us">Duration, microseconds.</param>
+void PhaseHistogram::add(uint32_t us) {
+	_buckets[bucketIndex(us)]++;
+	_count++;
+	_total_us += us;
+	if (us > _max_us) {
+		_max_us = us;
+	}
+}
+
+/// <summary>
+/// Returns the upper bound of the bucket that holds a
+/// percentile of durations, us (or the maximum, if less).
+/// </summary>
+/// <param name="percent">Percentile, such as 95.</param>
+uint32_t PhaseHistogram::percentile(float percent) const {
+	if (_count == 0) {
+		return 0;
+	}
+	// Rank of the duration at the percentile (1-based).
+	uint32_t rank = (uint32_t)(percent / 100 * _count + 0.5f);
+	if (rank < 1) {
+		rank = 1;
+	}
+	uint32_t seen = 0;
+	for (unsigned int i = 0; i < NUM_BUCKETS; i++) {
+		seen += _buckets[i];
+		if (seen >= rank) {
+			uint32_t upper = (i == 0) ? 0 : (uint32_t)((1ULL << i) - 1);
+			return (upper < _max_us) ? upper : _max_us;
+		}
+	}
+	return _max_us;
+}
+
+void PhaseHistogram::clear() {
+	*this = PhaseHistogram();
+}
+
+/// <summary>
+/// Records a duration of a phase.
+/// </summary>
+void PhaseTimer::record(loopPhase phase, uint32_t us) {
+	if (phase >= PHASE_COUNT) {
+		return;
+	}
+	portENTER_CRITICAL(&_mux);
+	_phases[phase].add(us);
+	portEXIT_CRITICAL(&_mux);
+}
+
+/// <summary>
+/// Returns a copy of a phase's histogram.
+/// </summary>
+PhaseHistogram PhaseTimer::histogram(loopPhase phase) const {
+	PhaseHistogram copy;
+	if (phase < PHASE_COUNT) {
+		portENTER_CRITICAL(&_mux);
+		copy = _phases[phase];
+		portEXIT_CRITICAL(&_mux);
+	}
+	return copy;
+}
+
+/// <summary>
+/// Clears all histograms.
+/// </summary>
+void PhaseTimer::clear() {
+	portENTER_CRITICAL(&_mux);
+	for (PhaseHistogram& histogram : _phases) {
+		histogram.clear();
+	}
+	portEXIT_CRITICAL(&_mux);
+}
+
+/// <summary>
+/// Returns a table of count, p50, p95, max and mean (us) of
+/// each phase that has durations.
+/// </summary>
+String PhaseTimer::report() const {
+	String text = "phase        count    p50_us    p95_us    max_us   mean_us\n";
+	char line[80];
+	for (unsigned int i = 0; i < PHASE_COUNT; i++) {
+		PhaseHistogram h = histogram((loopPhase)i);	// Consistent copy.
+		if (h.count() == 0) {
+			continue;
+		}
+		snprintf(line, sizeof(line), "%-10s %7lu %9lu %9lu %9lu %9lu\n",
+			name((loopPhase)i),
+			(unsigned long)h.count(),
+			(unsigned long)h.percentile(50),
+			(unsigned long)h.percentile(95),
+			(unsigned long)h.max(),
+			(unsigned long)(h.total() / h.count()));
+		text += line;
+	}
+	return text;
+}
+
+/// <summary>
+/// Returns the short name of a phase, such as "wind".
+/// </summary>
+const char* PhaseTimer::name(loopPhase phase) {
+	switch (phase)
+	{
+	case PHASE_ACQUISITION:
+		return "acquire";
+	case PHASE_PROCESSING:
+		return "process";
+	case PHASE_WIND:
+		return "wind";
+	case PHASE_FAN:
+		return "fan";
+	case PHASE_TEMP_DS18B20:
+		return "ds18b20";
+	case PHASE_UV_VEML6075:
+		return "veml6075";
+	case PHASE_PRH_BME280:
+		return "bme280";
+	case PHASE_IR_MLX90614:
+		return "mlx90614";
+	case PHASE_INSOLATION:
+		return "insol";
+	case PHASE_10_MIN:
+		return "10_min";
+	case PHASE_60_MIN:
+		return "60_min";
+	case PHASE_DAY:
+		return "day";
+	case PHASE_SD_FLUSH:
+		return "sd_flush";
+	case PHASE_WIFI_CHECK:
+		return "wifi";
+	default:
+		return "?";
+	}
+}
@@ -0,0 +1,139 @@
+// PhaseTimer.h
+
+#ifndef _PHASETIMER_h
+#define _PHASETIMER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Enumerates timed phases of the acquisition and processing
+/// tasks, loop() and the log flush task.
+/// </summary>
+enum loopPhase {
+	PHASE_ACQUISITION,		// Whole acquisition of a base period's sample.
+	PHASE_PROCESSING,		// Whole processing of a sample.
+	PHASE_WIND,				// readWind().
+	PHASE_FAN,				// readFan().
+	PHASE_TEMP_DS18B20,		// DS18B20 one-wire temperature.
+	PHASE_UV_VEML6075,		// VEML6075 UV (I2C).
+	PHASE_PRH_BME280,		// BME280 pressure, RH, temperature (I2C).
+	PHASE_IR_MLX90614,		// MLX90614 IR sky temperature (I2C).
+	PHASE_INSOLATION,		// Insolation ADC.
+	PHASE_10_MIN,			// 10-min processing (includes LittleFS appends).
+	PHASE_60_MIN,			// 60-min processing.
+	PHASE_DAY,				// Day processing.
+	PHASE_SD_FLUSH,			// Writing buffered logs to SD card.
+	PHASE_WIFI_CHECK,		// WiFi reconnection in loop().
+	PHASE_COUNT
+};
+
+/// <summary>
+/// Fixed-bucket histogram of durations. Bucket i holds
+/// durations of 2^(i-1) to 2^i - 1 us (bucket 0 holds 0 us),
+/// so percentiles are exact to within a factor of 2, and the
+/// maximum is exact. Adding a duration is a few instructions.
+/// </summary>
+class PhaseHistogram {
+
+public:
+
+	static const unsigned int NUM_BUCKETS = 27;	// Last bucket: 2^25 us (33 s) and longer.
+
+	/// <summary>
+	/// Adds a duration.
+	/// </summary>
+	/// <param name="us">Duration, microseconds.</param>
+	void add(uint32_t us);
+
+	/// <summary>
+	/// Returns the upper bound of the bucket that holds a
+	/// percentile of durations, us (or the maximum, if less).
+	/// </summary>
+	/// <param name="percent">Percentile, such as 95.</param>
+	uint32_t percentile(float percent) const;
+
+	uint32_t count() const { return _count; }
+	uint32_t max() const { return _max_us; }
+	uint64_t total() const { return _total_us; }
+	uint32_t bucket(unsigned int index) const { return _buckets[index]; }
+
+	/// <summary>
+	/// Returns the index of the bucket for a duration.
+	/// </summary>
+	static unsigned int bucketIndex(uint32_t us);
+
+	void clear();
+
+private:
+
+	uint32_t _buckets[NUM_BUCKETS] = {};	// Durations in each bucket.
+	uint32_t _count = 0;					// Durations added.
+	uint32_t _max_us = 0;					// Longest duration.
+	uint64_t _total_us = 0;					// Sum of durations.
+};
+
+/// <summary>
+/// Times phases of the station's tasks into a PhaseHistogram
+/// each, to show which sensor or write uses the BASE_PERIOD_SEC
+/// budget.
+/// Usage: t = PhaseTimer::start(); [phase]; timer.stop(PHASE_X, t);
+/// Times are from micros(), not the CPU cycle counter, as the
+/// 32-bit cycle count wraps in 18 s at 240 MHz and a WiFi
+/// reconnection blocks for up to 60 s.
+/// Any task may record; report() may be called from another.
+/// </summary>
+class PhaseTimer {
+
+public:
+
+	/// <summary>
+	/// Returns the start time of a phase.
+	/// </summary>
+	static unsigned long start() { return micros(); }
+
+	/// <summary>
+	/// Records the duration of a phase.
+	/// </summary>
+	/// <param name="phase">Phase timed.</param>
+	/// <param name="startMicros">Value returned by start().</param>
+	void stop(loopPhase phase, unsigned long startMicros) {
+		record(phase, (uint32_t)(micros() - startMicros));
+	}
+
+	/// <summary>
+	/// Records a duration of a phase.
+	/// </summary>
+	void record(loopPhase phase, uint32_t us);
+
+	/// <summary>
+	/// Returns a copy of a phase's histogram.
+	/// </summary>
+	PhaseHistogram histogram(loopPhase phase) const;
+
+	/// <summary>
+	/// Clears all histograms.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Returns a table of count, p50, p95, max and mean (us) of
+	/// each phase that has durations.
+	/// </summary>
+	String report() const;
+
+	/// <summary>
+	/// Returns the short name of a phase, such as "wind".
+	/// </summary>
+	static const char* name(loopPhase phase);
+
+private:
+
+	PhaseHistogram _phases[PHASE_COUNT];
+	mutable portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif
@@ -0,0 +1,133 @@
+// 
+// 
+// 
+
+#include "Placeholders.h"
+
+namespace Placeholders {
+
+	struct Placeholder {
+		const char* name;
+		placeholderId id;
+	};
+
+	/// <summary>
+	/// Placeholder names, sorted by strcmp (checked at compile time).
+	/// </summary>
+	constexpr Placeholder PLACEHOLDERS[] = {
+		{ "CHART_DATA_ROUTE", PH_CHART_DATA_ROUTE },
+		{ "CHART_TITLE", PH_CHART_TITLE },
+		{ "CHART_Y_AXIS_LABEL", PH_CHART_Y_AXIS_LABEL },
+		{ "CSS_LIGHT_STYLE", PH_CSS_LIGHT_STYLE },
+		{ "CURRENT_TIME", PH_CURRENT_TIME },
+		{ "ELAPSED_TIME_STRING", PH_ELAPSED_TIME_STRING },
+		{ "FAN_RPM", PH_FAN_RPM },
+		{ "GPS_ALTITUDE", PH_GPS_ALTITUDE },
+		{ "GPS_DATE", PH_GPS_DATE },
+		{ "GPS_DAYLIGHT_TIME_USED", PH_GPS_DAYLIGHT_TIME_USED },
+		{ "GPS_HDOP", PH_GPS_HDOP },
+		{ "GPS_IS_SYNCED", PH_GPS_IS_SYNCED },
+		{ "GPS_LATITUDE", PH_GPS_LATITUDE },
+		{ "GPS_LOCATIONS_UPDATE_COUNTER", PH_GPS_LOCATIONS_UPDATE_COUNTER },
+		{ "GPS_LONGITUDE", PH_GPS_LONGITUDE },
+		{ "GPS_SATELLITES", PH_GPS_SATELLITES },
+		{ "GPS_TIME", PH_GPS_TIME },
+		{ "INSOLATION_PERCENT", PH_INSOLATION_PERCENT },
+		{ "INSOLATION_PERCENT_HI", PH_INSOLATION_PERCENT_HI },
+		{ "IR_T_SKY", PH_IR_T_SKY },
+		{ "IR_T_SKY_HI", PH_IR_T_SKY_HI },
+		{ "IR_T_SKY_LO", PH_IR_T_SKY_LO },
+		{ "LAST_READINGS_DATETIME", PH_LAST_READINGS_DATETIME },
+		{ "PRESSURE_MB_ABS", PH_PRESSURE_MB_ABS },
+		{ "PRESSURE_MB_SL", PH_PRESSURE_MB_SL },
+		{ "PRESSURE_MB_SL_HI", PH_PRESSURE_MB_SL_HI },
+		{ "PRESSURE_MB_SL_LO", PH_PRESSURE_MB_SL_LO },
+		{ "REL_HUMIDITY", PH_REL_HUMIDITY },
+		{ "REL_HUMIDITY_HI", PH_REL_HUMIDITY_HI },
+		{ "REL_HUMIDITY_LO", PH_REL_HUMIDITY_LO },
+		{ "TEMPERATURE_F", PH_TEMPERATURE_F },
+		{ "TEMPERATURE_F_HI", PH_TEMPERATURE_F_HI },
+		{ "TEMPERATURE_F_LO", PH_TEMPERATURE_F_LO },
+		{ "UTC_CURRENT_OFFSET_HOURS", PH_UTC_CURRENT_OFFSET_HOURS },
+		{ "UV_A", PH_UV_A },
+		{ "UV_A_HI", PH_UV_A_HI },
+		{ "UV_B", PH_UV_B },
+		{ "UV_B_HI", PH_UV_B_HI },
+		{ "UV_INDEX", PH_UV_INDEX },
+		{ "UV_INDEX_HI", PH_UV_INDEX_HI },
+		{ "WATER_BOILING_POINT", PH_WATER_BOILING_POINT },
+		{ "WEEKDAY", PH_WEEKDAY },
+		{ "WIND_ANGLE", PH_WIND_ANGLE },
+		{ "WIND_ANGLE_HI", PH_WIND_ANGLE_HI },
+		{ "WIND_DIRECTION", PH_WIND_DIRECTION },
+		{ "WIND_GUST", PH_WIND_GUST },
+		{ "WIND_GUST_HI", PH_WIND_GUST_HI },
+		{ "WIND_GUST_LO", PH_WIND_GUST_LO },
+		{ "WIND_SPEED", PH_WIND_SPEED },
+		{ "WIND_SPEED_HI", PH_WIND_SPEED_HI },
+		{ "WIND_SPEED_LO", PH_WIND_SPEED_LO },
+		{ "Y_MAX", PH_Y_MAX },
+		{ "Y_MIN", PH_Y_MIN },
+		{ "Y_TICK_AMOUNT", PH_Y_TICK_AMOUNT }
+	};
+
+	const unsigned int PLACEHOLDER_COUNT = sizeof(PLACEHOLDERS) / sizeof(PLACEHOLDERS[0]);
+
+	// Compile-time checks (C++11 constexpr functions are single return statements).
+
+	constexpr int compareNames(const char* a, const char* b) {
+		return (*a != *b || *a == '\0') ? (unsigned char)*a - (unsigned char)*b : compareNames(a + 1, b + 1);
+	}
+
+	constexpr bool isSorted(unsigned int index) {
+		return index + 1 >= PLACEHOLDER_COUNT
+			|| (compareNames(PLACEHOLDERS[index].name, PLACEHOLDERS[index + 1].name) < 0 && isSorted(index + 1));
+	}
+
+	static_assert(isSorted(0), "Placeholders::PLACEHOLDERS must be sorted by name, without duplicates.");
+	static_assert(PLACEHOLDER_COUNT == PH_Y_TICK_AMOUNT, "Placeholders::PLACEHOLDERS must list every placeholderId.");
+
+	/// <summary>
+	/// Returns the id of a placeholder name, or PH_NONE.
+	/// </summary>
+	/// <param name="name">Placeholder name, without the "%" delimiters.</param>
+	/// <returns>Placeholder id.</returns>
+	placeholderId find(const char* name) {
+		unsigned int lo = 0, hi = PLACEHOLDER_COUNT;
+		while (lo < hi) {
+			unsigned int mid = (lo + hi) / 2;
+			int cmp = strcmp(name, PLACEHOLDERS[mid].name);
+			if (cmp == 0) {
+				return PLACEHOLDERS[mid].id;
+			}
+			if (cmp < 0) {
+				hi = mid;
+			}
+			else {
+				lo = mid + 1;
+			}
+		}
+		return PH_NONE;
+	}
+
+	/// <summary>
+	/// Returns the name of a placeholder id, or "" for PH_NONE.
+	/// </summary>
+	/// <param name="id">Placeholder id.</param>
+	/// <returns>Placeholder name.</returns>
+	const char* name(placeholderId id) {
+		for (const Placeholder& placeholder : PLACEHOLDERS) {
+			if (placeholder.id == id) {
+				return placeholder.name;
+			}
+		}
+		return "";
+	}
+
+	/// <summary>
+	/// Returns the number of known placeholders.
+	/// </summary>
+	unsigned int count() {
+		return PLACEHOLDER_COUNT;
+	}
+}
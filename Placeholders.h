@@ -0,0 +1,113 @@
+// Placeholders.h
+
+#ifndef _PLACEHOLDERS_h
+#define _PLACEHOLDERS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Exposes lookup of %PLACEHOLDER% names in served html pages.
+/// Names are held in a table sorted at compile time, so a name
+/// is found by binary search, and the web server processor
+/// then switches on the returned id.
+/// </summary>
+namespace Placeholders {
+
+	/// <summary>
+	/// Enumerates placeholders replaced by the web server processor.
+	/// </summary>
+	enum placeholderId {
+		PH_NONE,	// Not a known placeholder.
+
+		// Page style.
+		PH_CSS_LIGHT_STYLE,
+
+		// Current sensor readings.
+		PH_LAST_READINGS_DATETIME,
+		PH_CURRENT_TIME,
+		PH_WEEKDAY,
+		PH_TEMPERATURE_F,
+		PH_WIND_SPEED,
+		PH_WIND_GUST,
+		PH_WIND_DIRECTION,
+		PH_WIND_ANGLE,
+		PH_PRESSURE_MB_SL,
+		PH_PRESSURE_MB_ABS,
+		PH_WATER_BOILING_POINT,
+		PH_INSOLATION_PERCENT,
+		PH_REL_HUMIDITY,
+		PH_UV_A,
+		PH_UV_B,
+		PH_UV_INDEX,
+		PH_IR_T_SKY,
+
+		// Daily maxima.
+		PH_TEMPERATURE_F_HI,
+		PH_WIND_SPEED_HI,
+		PH_WIND_GUST_HI,
+		PH_WIND_ANGLE_HI,
+		PH_PRESSURE_MB_SL_HI,
+		PH_INSOLATION_PERCENT_HI,
+		PH_REL_HUMIDITY_HI,
+		PH_UV_A_HI,
+		PH_UV_B_HI,
+		PH_UV_INDEX_HI,
+		PH_IR_T_SKY_HI,
+
+		// Daily minima.
+		PH_TEMPERATURE_F_LO,
+		PH_WIND_SPEED_LO,
+		PH_WIND_GUST_LO,
+		PH_PRESSURE_MB_SL_LO,
+		PH_REL_HUMIDITY_LO,
+		PH_IR_T_SKY_LO,
+
+		// GPS data.
+		PH_GPS_IS_SYNCED,
+		PH_GPS_LOCATIONS_UPDATE_COUNTER,
+		PH_GPS_LATITUDE,
+		PH_GPS_LONGITUDE,
+		PH_GPS_ALTITUDE,
+		PH_GPS_DATE,
+		PH_GPS_TIME,
+		PH_GPS_DAYLIGHT_TIME_USED,
+		PH_GPS_HDOP,
+		PH_GPS_SATELLITES,
+		PH_ELAPSED_TIME_STRING,
+		PH_FAN_RPM,
+
+		// Chart fields.
+		PH_UTC_CURRENT_OFFSET_HOURS,
+		PH_CHART_DATA_ROUTE,
+		PH_CHART_Y_AXIS_LABEL,
+		PH_CHART_TITLE,
+		PH_Y_MIN,
+		PH_Y_MAX,
+		PH_Y_TICK_AMOUNT
+	};
+
+	/// <summary>
+	/// Returns the id of a placeholder name, or PH_NONE.
+	/// </summary>
+	/// <param name="name">Placeholder name, without the "%" delimiters.</param>
+	/// <returns>Placeholder id.</returns>
+	placeholderId find(const char* name);
+
+	/// <summary>
+	/// Returns the name of a placeholder id, or "" for PH_NONE.
+	/// </summary>
+	/// <param name="id">Placeholder id.</param>
+	/// <returns>Placeholder name.</returns>
+	const char* name(placeholderId id);
+
+	/// <summary>
+	/// Returns the number of known placeholders.
+	/// </summary>
+	unsigned int count();
+}
+
+#endif
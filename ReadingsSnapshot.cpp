@@ -0,0 +1,40 @@
+// 
+// 
+// 
+
+#include "ReadingsSnapshot.h"
+
+/// <summary>
+/// Copies the values of the registered sensors.
+/// Processing task only.
+/// </summary>
+void ReadingsSnapshot::take(const SensorRegistry& registry, WindDirection& windDir, unsigned long sampleTime) {
+	time = sampleTime;
+	count = 0;
+	for (const SensorRegistry::Entry& entry : registry) {
+		SensorData& sensor = *entry.sensor;
+		Values& values = sensors[count++];
+		values.avg_now = sensor.avg_now();
+		values.avg_10_min = sensor.avg_10_min();
+		values.max_10_min = sensor.max_10_min().value;
+		values.max_today = sensor.max_today().value;
+		values.min_today = sensor.min_today().value;
+		values.last = sensor.valueLastAdded();
+	}
+	windAngle_now = windDir.angleAvg_now();
+	windAngle_10_min = windDir.avg_10_min();
+}
+
+/// <summary>
+/// Returns the values of a sensor, or zeros if
+/// the sensor was not taken.
+/// </summary>
+const ReadingsSnapshot::Values& ReadingsSnapshot::of(const SensorRegistry& registry, const SensorData& sensor) const {
+	static const Values NONE = {};
+	for (unsigned int i = 0; i < count && i < registry.size(); i++) {
+		if (registry[i].sensor == &sensor) {
+			return sensors[i];
+		}
+	}
+	return NONE;
+}
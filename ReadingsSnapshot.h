@@ -0,0 +1,60 @@
+// ReadingsSnapshot.h
+
+#ifndef _READINGSSNAPSHOT_h
+#define _READINGSSNAPSHOT_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "SensorRegistry.h"
+#include "WindDirection.h"
+
+/// <summary>
+/// Copy of the values of every registered sensor that the web
+/// pages show, taken by the processing task after each sample
+/// and published through a Seqlock. Web handlers read the copy
+/// instead of the SensorData instances, which the processing
+/// task changes while the handlers run.
+/// </summary>
+struct ReadingsSnapshot {
+
+	/// <summary>
+	/// Values of one sensor.
+	/// </summary>
+	struct Values {
+		float avg_now;		// Running avg of current 10-min period.
+		float avg_10_min;	// Avg of last 10-min period.
+		float max_10_min;	// Max of current 10-min period.
+		float max_today;	// Today's maximum.
+		float min_today;	// Today's minimum.
+		float last;			// Last reading.
+	};
+
+	unsigned long time = 0;			// Time of the sample taken.
+	unsigned int count = 0;			// Sensors taken.
+	float windAngle_now = 0;		// Wind direction avg since last cleared (<= 10 min), deg.
+	float windAngle_10_min = 0;		// Last 10-min avg wind direction, deg.
+	Values sensors[App_Settings::SENSOR_REGISTRY_SIZE];	// By registry index.
+
+	/// <summary>
+	/// Copies the values of the registered sensors.
+	/// Processing task only.
+	/// </summary>
+	/// <param name="registry">Registered sensors.</param>
+	/// <param name="windDir">Wind direction sensor.</param>
+	/// <param name="sampleTime">Time of the sample taken.</param>
+	void take(const SensorRegistry& registry, WindDirection& windDir, unsigned long sampleTime);
+
+	/// <summary>
+	/// Returns the values of a sensor, or zeros if
+	/// the sensor was not taken.
+	/// </summary>
+	/// <param name="registry">Registry the snapshot was taken from.</param>
+	/// <param name="sensor">Sensor instance.</param>
+	const Values& of(const SensorRegistry& registry, const SensorData& sensor) const;
+};
+
+#endif
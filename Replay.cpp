@@ -0,0 +1,173 @@
+// 
+// 
+// 
+
+#include "Replay.h"
+#include "Utilities.h"
+
+/// <summary>
+/// Replays ticks from a start time.
+/// </summary>
+/// <param name="startTime">Time (sec) at which replay starts.</param>
+/// <param name="numTicks">Number of base periods to replay.</param>
+/// <returns>Counts of work done.</returns>
+Replay::Stats Replay::run(unsigned long startTime, unsigned long numTicks) {
+	_stats = Stats();
+	setTime(startTime);
+	_ticks.startDay();
+	const unsigned long period = (unsigned long)BASE_PERIOD_SEC;
+	unsigned long timeStart = micros();
+	for (unsigned long i = 1; i <= numTicks; i++) {
+		setTime(startTime + i * period);	// Timer fires at end of each period.
+		_ticks.onTimer(micros(), 0, 0);	// Simulated wind and fan need no counts.
+		step();
+	}
+	_stats.elapsed_us = micros() - timeStart;
+	return _stats;
+}
+
+/// <summary>
+/// Acquires a sample for each queued tick, then processes the
+/// samples queued.
+/// </summary>
+void Replay::step() {
+	acquire();
+	TickSample sample;
+	while (_queue.pop(sample)) {
+		process(sample);
+	}
+}
+
+/// <summary>
+/// Reads sensors for each queued tick, flags the periods that
+/// it ends, and queues the sample, as acquireSample() in the sketch.
+/// </summary>
+void Replay::acquire() {
+	TimerTicks::Tick tick;
+	while (_ticks.take(tick)) {
+		TickSample sample;
+		sample.time = now();
+		sample.flags |= TickSample::SAMPLE_READ;
+		_readSensors(sample);
+		if (tick.is_10_min) {
+			sample.flags |= TickSample::SAMPLE_10_MIN;
+		}
+		if (tick.is_60_min) {
+			sample.flags |= TickSample::SAMPLE_60_MIN;
+		}
+		if (_ticks.takeNewDay()) {
+			sample.flags |= TickSample::SAMPLE_NEW_DAY;
+		}
+		_queue.push(sample);
+	}
+}
+
+/// <summary>
+/// Adds a sample's readings and does the period processing it
+/// calls for, as processSample() in the sketch.
+/// </summary>
+void Replay::process(const TickSample& sample) {
+	if (sample.has(TickSample::SAMPLE_READ)) {
+		_applySample(sample);
+		_stats.ticks++;
+	}
+	if (sample.has(TickSample::SAMPLE_10_MIN)) {
+		_sensors.process(PERIOD_10_MIN);
+		_stats.periods_10_min++;
+	}
+	if (sample.has(TickSample::SAMPLE_60_MIN)) {
+		_sensors.process(PERIOD_60_MIN);
+		_stats.periods_60_min++;
+	}
+	if (sample.has(TickSample::SAMPLE_NEW_DAY)) {
+		_sensors.process(PERIOD_DAY);
+		_stats.days++;
+	}
+}
+
+SimulatedStation::SimulatedStation() :
+	windSpeed(DAVIS_SPEED_CAL_FACTOR, true, WIND_SPEED_NUMBER_IN_MOVING_AVG, WIND_SPEED_OUTLIER_DELTA),
+	windGust(false),
+	windSustained(false, false, false),
+	windPeak(false, false, false),
+	windDir(VANE_OFFSET),
+	temp_F(false),
+	pres_mb(false),
+	pres_seaLvl_mb(false),
+	temp_for_RH_C(false),
+	rh(false),
+	uvA(false),
+	uvB(false),
+	uvIndex(false),
+	insol(false, true),
+	irSky_C(false),
+	fanRPM(false)
+{
+	typedef SensorRegistry R;
+	// As sensors_register() in the sketch.
+	windGust.setPeriodValue(PERIOD_VALUE_LAST);
+	windSustained.setPeriodValue(PERIOD_VALUE_LAST);
+	windPeak.setPeriodValue(PERIOD_VALUE_MAX);
+	windDir.setSeriesScale(0.1);
+	pres_mb.setSeriesScale(0.1);
+	pres_seaLvl_mb.setSeriesScale(0.1);
+	uvA.setSeriesScale(1);
+	uvB.setSeriesScale(1);
+	insol.setSeriesScale(0.1);
+	fanRPM.setSeriesScale(1);
+	sensors.add(windSpeed, "Wind Speed", "wind", "mph", "", CHART_WIND_SPEED, R::ROLE_ALL);
+	sensors.add(windGust, "Wind Gust", "gust", "mph", "", CHART_WIND_GUST, R::ROLE_ALL & ~R::ROLE_DAY);
+	sensors.add(windSustained, "Sustained Wind", "windSust", "mph", "", CHART_WIND_SUSTAINED, R::ROLE_ALL);
+	sensors.add(windPeak, "Peak Wind", "windPeak", "mph", "", CHART_WIND_PEAK, R::ROLE_ALL & ~R::ROLE_CHART_MAX_MIN);
+	sensors.add(windDir, "Wind direction", "windDir", "", "&deg;", CHART_WIND_DIRECTION, R::ROLE_ALL & ~R::ROLE_CHART_MAX_MIN);
+	sensors.add(windDir.sigmaTheta(), "Wind dir. std. dev.", "windSigma", "deg", "&deg;", CHART_WIND_SIGMA, R::ROLE_ALL);
+	sensors.add(temp_F, "Temperature", "temp", "F", "&deg;F", CHART_TEMPERATURE_F, R::ROLE_ALL);
+	sensors.add(pres_mb, "Pressure (abs)", "presAbs", "mb", "", CHART_NONE, R::ROLE_10_MIN);
+	sensors.add(pres_seaLvl_mb, "Pressure (SL)", "presSeaLvl", "mb", "", CHART_PRESSURE_SEA_LEVEL, R::ROLE_ALL);
+	sensors.add(temp_for_RH_C, "Temp for RH", "tForRH", "C", "&degC;", CHART_NONE, R::ROLE_10_MIN);
+	sensors.add(rh, "Rel. Humidity", "RH", "%", "&percnt;", CHART_RELATIVE_HUMIDITY, R::ROLE_ALL);
+	sensors.add(uvA, "UV A Radiation", "uvA", "", "", CHART_NONE, R::ROLE_10_MIN | R::ROLE_60_MIN | R::ROLE_DAY);
+	sensors.add(uvB, "UV B Radiation", "uvB", "", "", CHART_NONE, R::ROLE_10_MIN | R::ROLE_60_MIN | R::ROLE_DAY);
+	sensors.add(uvIndex, "UV Index", "uvIndex", "", "", CHART_UV_INDEX, R::ROLE_ALL);
+	sensors.add(insol, "Insolation", "sun", "%", "&percnt;", CHART_INSOLATION, R::ROLE_ALL);
+	sensors.add(irSky_C, "Sky Temperature", "skyTemp", "C", "&degC;", CHART_IR_SKY, R::ROLE_ALL);
+	sensors.add(fanRPM, "Aspirator Fan speedInstant", "fanSpeed", "rpm", "", CHART_NONE, R::ROLE_NONE);
+}
+
+/// <summary>
+/// Adds one tick's simulated readings (at now()) to a sample.
+/// </summary>
+void SimulatedStation::read(TickSample& sample) {
+	// Wind, as readWind_Simulate().
+	float rotsPerMph = BASE_PERIOD_SEC / DAVIS_SPEED_CAL_FACTOR;
+	sample.anemRotations = _sim_anemCount.linear(3 * rotsPerMph, 0.025f * rotsPerMph, 15 * rotsPerMph, 50, 6);
+	sample.windAngle = _sim_windDir.sawtooth(90, 1, 360);
+	sample.add(fanRPM, _sim_fanRPM.sawtooth(2000, 10, 2400));
+
+	// Other sensors, as readSensors_Simulate().
+	sample.add(temp_F, _sim_temp_F.sawtooth(10, 0.02, 20));
+	sample.add(uvIndex, _sim_uvIndex.sawtooth(0, 0.05, 10));
+	sample.add(rh, _sim_rh.sawtooth(0, 0.05, 50));
+	sample.add(pres_mb, _sim_pres_mb.linear(3, 0.1) / 100);
+	sample.add(pres_seaLvl_mb, Utilities::pressureAtSeaLevel(_sim_pres_seaLvl_mb.linear(950, 0.01), 1500, 25));
+	sample.add(irSky_C, _sim_irSky_C.sawtooth(10, 0.02, 20));
+	sample.add(insol, Utilities::insol_norm_pct(_sim_insol.linear(0, 0.01), INSOL_REFERENCE_MAX));
+}
+
+/// <summary>
+/// Adds a sample's wind counts and readings to the sensors,
+/// as applySample() in the sketch.
+/// </summary>
+void SimulatedStation::apply(const TickSample& sample) {
+	float speed = windSpeed.speedInstant(sample.anemRotations, BASE_PERIOD_SEC);
+	dataPoint dpSpeed(sample.time, speed);
+	windSpeed.addReading(dpSpeed);
+	float peak = (sample.gust_3s > 0) ? sample.gust_3s : speed;
+	windAggregator.add(speed, peak);
+	windSustained.addReading(dataPoint(sample.time, windAggregator.sustained()));
+	windGust.addReading(dataPoint(sample.time, windAggregator.gust()));
+	windPeak.addReading(dataPoint(sample.time, windAggregator.peakWind()));
+	float speedAtVane = (sample.speed_now >= 0) ? sample.speed_now : speed;
+	windDir.addReading(sample.time, sample.windAngle, speedAtVane);
+	sample.apply();
+}
@@ -0,0 +1,144 @@
+// Replay.h
+
+#ifndef _REPLAY_h
+#define _REPLAY_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <functional>
+#include "App_Settings.h"
+#include "TimerTicks.h"
+#include "TickSample.h"
+#include "SpscQueue.h"
+#include "SensorRegistry.h"
+#include "SensorSimulate.h"
+#include "WindSpeed2.h"
+#include "WindDirection.h"
+#include "WindAggregator.h"
+
+/// <summary>
+/// Runs the station's period processing on a virtual clock, as
+/// fast as the CPU allows. Each tick sets now() (TimeLib) one
+/// BASE_PERIOD_SEC later, queues a timer tick in TimerTicks,
+/// and then does what the acquisition task does with the tick
+/// (read sensors into a queued TickSample), and what the
+/// processing task does with the sample (add readings, and
+/// process 10-min, 60-min and day data). A month of ticks
+/// takes seconds, so day rollovers and list wrap-around can be
+/// tested without waiting for them.
+/// Sets the TimeLib clock, so is for the host or a debug build.
+/// </summary>
+class Replay {
+
+public:
+
+	/// <summary>
+	/// Counts of work done by a run.
+	/// </summary>
+	struct Stats {
+		unsigned long ticks = 0;			// Base periods (sensor reads).
+		unsigned long periods_10_min = 0;	// 10-min periods processed.
+		unsigned long periods_60_min = 0;	// 60-min periods processed.
+		unsigned long days = 0;				// Day rollovers processed.
+		unsigned long elapsed_us = 0;		// Wall-clock time of run.
+
+		/// <summary>
+		/// Returns ticks replayed per wall-clock second.
+		/// </summary>
+		float ticksPerSecond() const {
+			return (elapsed_us > 0) ? 1e6f * ticks / elapsed_us : 0;
+		}
+	};
+
+	/// <summary>
+	/// Creates a replay of registered sensors.
+	/// </summary>
+	/// <param name="sensors">Sensors processed each period.</param>
+	/// <param name="readSensors">Adds one tick's readings to a sample.</param>
+	/// <param name="applySample">Adds a sample's readings to the sensors.</param>
+	Replay(SensorRegistry& sensors,
+		std::function<void(TickSample&)> readSensors,
+		std::function<void(const TickSample&)> applySample)
+		: _sensors(sensors), _readSensors(readSensors), _applySample(applySample) {}
+
+	/// <summary>
+	/// Replays ticks from a start time.
+	/// </summary>
+	/// <param name="startTime">Time (sec) at which replay starts.</param>
+	/// <param name="numTicks">Number of base periods to replay.</param>
+	/// <returns>Counts of work done.</returns>
+	Stats run(unsigned long startTime, unsigned long numTicks);
+
+	/// <summary>
+	/// Returns the timer ticks driven by the replay.
+	/// </summary>
+	const TimerTicks& ticks() const { return _ticks; }
+
+private:
+
+	SensorRegistry& _sensors;								// Sensors to process.
+	std::function<void(TickSample&)> _readSensors;			// Adds one tick's readings to a sample.
+	std::function<void(const TickSample&)> _applySample;	// Adds a sample's readings to the sensors.
+	TimerTicks _ticks;										// Ticks driven by virtual clock.
+	SpscQueue<TickSample, App_Settings::SAMPLE_QUEUE_SIZE> _queue;	// Samples waiting for processing.
+	Stats _stats;
+
+	void step();
+	void acquire();
+	void process(const TickSample& sample);
+};
+
+/// <summary>
+/// The station's sensors, registered as in sensors_register(),
+/// with readings from SensorSimulate waveforms (as in the
+/// sketch's readWind_Simulate and readSensors_Simulate), and
+/// without data files.
+/// </summary>
+class SimulatedStation {
+
+public:
+
+	WindSpeed windSpeed;
+	SensorData windGust;
+	SensorData windSustained;
+	SensorData windPeak;
+	WindAggregator windAggregator;
+	WindDirection windDir;
+	SensorData temp_F;
+	SensorData pres_mb;
+	SensorData pres_seaLvl_mb;
+	SensorData temp_for_RH_C;
+	SensorData rh;
+	SensorData uvA;
+	SensorData uvB;
+	SensorData uvIndex;
+	SensorData insol;
+	SensorData irSky_C;
+	SensorData fanRPM;
+
+	SensorRegistry sensors;
+
+	SimulatedStation();
+
+	/// <summary>
+	/// Adds one tick's simulated readings (at now()) to a sample.
+	/// </summary>
+	void read(TickSample& sample);
+
+	/// <summary>
+	/// Adds a sample's wind counts and readings to the sensors,
+	/// as applySample() in the sketch.
+	/// </summary>
+	void apply(const TickSample& sample);
+
+private:
+
+	SensorSimulate _sim_anemCount, _sim_windDir, _sim_temp_F, _sim_uvIndex,
+		_sim_rh, _sim_pres_mb, _sim_pres_seaLvl_mb, _sim_irSky_C, _sim_insol, _sim_fanRPM;
+};
+
+#endif
@@ -0,0 +1,164 @@
+// RingBuffer.h
+
+#ifndef _RINGBUFFER_h
+#define _RINGBUFFER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Circular buffer of elements held in storage owned by a derived
+/// class (see FixedRingBuffer). Adding to a full buffer overwrites
+/// the oldest element, so no memory is allocated after construction.
+/// Index 0 is the oldest element; index size() - 1 is the newest.
+/// </summary>
+template <typename T>
+class RingBuffer {
+
+protected:
+
+	T* _data;					// Element storage (owned by derived class).
+	unsigned int _capacity;		// Number of elements storage can hold.
+	unsigned int _head = 0;		// Storage index of the oldest element.
+	unsigned int _count = 0;	// Number of elements held.
+
+	/// <summary>
+	/// Creates an empty ring buffer over existing storage.
+	/// </summary>
+	/// <param name="storage">Array of at least capacity elements.</param>
+	/// <param name="capacity">Number of elements in storage.</param>
+	RingBuffer(T* storage, unsigned int capacity) :
+		_data(storage), _capacity(capacity)
+	{}
+
+	// Storage is not owned here, so only derived classes may copy.
+	RingBuffer(const RingBuffer&) = delete;
+
+public:
+
+	/// <summary>
+	/// Forward iterator from oldest to newest element.
+	/// </summary>
+	class const_iterator {
+		const RingBuffer* _buffer;
+		unsigned int _index;
+	public:
+		const_iterator(const RingBuffer* buffer, unsigned int index) :
+			_buffer(buffer), _index(index) {}
+		const T& operator*() const { return (*_buffer)[_index]; }
+		const T* operator->() const { return &(*_buffer)[_index]; }
+		const_iterator& operator++() { _index++; return *this; }
+		const_iterator operator++(int) { const_iterator it = *this; _index++; return it; }
+		bool operator==(const const_iterator& other) const { return _index == other._index; }
+		bool operator!=(const const_iterator& other) const { return _index != other._index; }
+	};
+
+	/// <summary>
+	/// Copies elements from another ring buffer. If the source holds
+	/// more elements than this capacity, only the newest are kept.
+	/// </summary>
+	/// <param name="other">Ring buffer to copy.</param>
+	RingBuffer& operator=(const RingBuffer& other) {
+		if (this != &other) {
+			clear();
+			unsigned int first = (other._count > _capacity) ? other._count - _capacity : 0;
+			for (unsigned int i = first; i < other._count; i++) {
+				push_back(other[i]);
+			}
+		}
+		return *this;
+	}
+
+	/// <summary>
+	/// Adds an element after the newest. If the buffer is full,
+	/// the oldest element is overwritten.
+	/// </summary>
+	/// <param name="val">Element to add.</param>
+	void push_back(const T& val) {
+		if (_count < _capacity) {
+			_data[(_head + _count) % _capacity] = val;
+			_count++;
+		}
+		else {
+			_data[_head] = val;		// Overwrite oldest.
+			_head = (_head + 1) % _capacity;
+		}
+	}
+
+	/// <summary>
+	/// Removes the oldest element, if any.
+	/// </summary>
+	void pop_front() {
+		if (_count > 0) {
+			_head = (_head + 1) % _capacity;
+			_count--;
+		}
+	}
+
+	/// <summary>
+	/// Removes all elements.
+	/// </summary>
+	void clear() {
+		_head = 0;
+		_count = 0;
+	}
+
+	/// <summary>
+	/// Returns element by age, where 0 is the oldest.
+	/// </summary>
+	/// <param name="index">Index from 0 to size() - 1.</param>
+	const T& operator[](unsigned int index) const {
+		return _data[(_head + index) % _capacity];
+	}
+
+	/// <summary>
+	/// Returns element by age, where 0 is the oldest.
+	/// </summary>
+	/// <param name="index">Index from 0 to size() - 1.</param>
+	T& operator[](unsigned int index) {
+		return _data[(_head + index) % _capacity];
+	}
+
+	const T& front() const { return (*this)[0]; }		// Oldest element.
+	const T& back() const { return (*this)[_count - 1]; }	// Newest element.
+
+	unsigned int size() const { return _count; }
+	unsigned int capacity() const { return _capacity; }
+	bool empty() const { return _count == 0; }
+	bool full() const { return _count == _capacity; }
+
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, _count); }
+};
+
+/// <summary>
+/// Ring buffer with statically-sized storage for CAPACITY elements.
+/// </summary>
+template <typename T, unsigned int CAPACITY>
+class FixedRingBuffer : public RingBuffer<T> {
+
+	T _storage[CAPACITY];
+
+public:
+
+	FixedRingBuffer() : RingBuffer<T>(_storage, CAPACITY) {}
+
+	FixedRingBuffer(const FixedRingBuffer& other) : RingBuffer<T>(_storage, CAPACITY) {
+		RingBuffer<T>::operator=(other);
+	}
+
+	FixedRingBuffer& operator=(const FixedRingBuffer& other) {
+		RingBuffer<T>::operator=(other);
+		return *this;
+	}
+
+	FixedRingBuffer& operator=(const RingBuffer<T>& other) {
+		RingBuffer<T>::operator=(other);
+		return *this;
+	}
+};
+
+#endif
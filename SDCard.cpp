@@ -3,6 +3,9 @@
 // 
 
 #include "SDCard.h"
+#include <esp_system.h>
+
+SDCard* SDCard::_shutdownInstance = nullptr;
 
 /// <summary>
 /// Creates SD card instance. 
@@ -37,11 +40,13 @@ bool SDCard::create(int SPI_CS_pin, bool isBypass) {
 		logStatus(LINE_SEPARATOR_LOG_BEGINS);
 		logStatus("[SDCard.create] Logging has started.", millis());
 		logStatus("[SDCard.create] MicroSD card mount successful.", millis());
+		beginFlushTask();
 		return true;
 	}
 	else {
 		// Failure.
 		logStatus("[SDCard.create] ERROR: MicroSD card mount failed.", millis());
+		beginFlushTask();
 		return false;
 	}
 }
@@ -132,6 +137,138 @@ void SDCard::cancelBypass()
 //	file.close();
 //}
 
+/// <summary>
+/// Adds text to a log buffer, waking the flush task
+/// if enough text is waiting. Text that does not fit
+/// is counted and reported in the log at next flush.
+/// </summary>
+/// <param name="log">Buffer to add to.</param>
+/// <param name="text">Text to add.</param>
+void SDCard::logWrite(LogBuffer& log, const String& text) {
+	bool isAdded = log.write(text.c_str(), text.length());
+	if (_flushTask != nullptr && (!isAdded || log.size() >= _flushBytes)) {
+		xTaskNotifyGive(_flushTask);
+	}
+}
+
+/// <summary>
+/// Writes a log buffer to its file on the card, opening
+/// the file once for all waiting text.
+/// </summary>
+/// <param name="log">Buffer to write.</param>
+/// <param name="path">Log file path.</param>
+void SDCard::flushLog(LogBuffer& log, const String& path) {
+	unsigned long droppedBytes = log.takeDroppedBytes();
+	size_t remaining = log.size();	// Text added while writing waits for next flush.
+	if (remaining == 0 && droppedBytes == 0) {
+		return;
+	}
+	File file = SD.open(path, FILE_APPEND);
+	if (!file) {
+		Serial.printf("ERROR: SDCard could not open %s; %u log bytes discarded.\n",
+			path.c_str(), (unsigned int)remaining);
+		log.consume(remaining);
+		return;
+	}
+	char block[DATA_FILE_BUFFER_SIZE];
+	while (remaining > 0) {
+		size_t length = log.peek(block, (remaining < sizeof(block)) ? remaining : sizeof(block));
+		if (file.write((const uint8_t*)block, length) != length) {
+			Serial.printf("ERROR: SDCard could not write %s\n", path.c_str());
+			break;	// Keep text for next flush.
+		}
+		log.consume(length);
+		remaining -= length;
+	}
+	if (droppedBytes > 0) {
+		file.printf("[SDCard] Log buffer full; %lu bytes dropped.\r\n", droppedBytes);
+	}
+	file.close();
+}
+
+/// <summary>
+/// Writes all buffered log text to the card now.
+/// </summary>
+void SDCard::flush() {
+	if (_flushMutex != nullptr) {
+		xSemaphoreTake(_flushMutex, portMAX_DELAY);
+	}
+	unsigned long timeStart = PhaseTimer::start();
+	flushLog(_statusLog, LOGFILE_PATH_STATUS);
+	flushLog(_dataLog, LOGFILE_PATH_DATA);
+	if (_phaseTimer != nullptr) {
+		_phaseTimer->stop(PHASE_SD_FLUSH, timeStart);
+	}
+	if (_flushMutex != nullptr) {
+		xSemaphoreGive(_flushMutex);
+	}
+}
+
+/// <summary>
+/// Sets when the background task flushes buffered log text.
+/// </summary>
+/// <param name="flushBytes">Flush when this many bytes are waiting.</param>
+/// <param name="flushAgeMs">Flush when oldest text is this old, ms.</param>
+void SDCard::setFlushThresholds(unsigned int flushBytes, unsigned long flushAgeMs) {
+	_flushBytes = flushBytes;
+	_flushAgeMs = flushAgeMs;
+	if (_flushTask != nullptr) {
+		xTaskNotifyGive(_flushTask);	// Recheck with new thresholds.
+	}
+}
+
+/// <summary>
+/// Returns true if buffered log text has reached a flush threshold.
+/// </summary>
+bool SDCard::isFlushDue() const {
+	return _statusLog.size() >= _flushBytes
+		|| _dataLog.size() >= _flushBytes
+		|| _statusLog.ageMillis() >= _flushAgeMs
+		|| _dataLog.ageMillis() >= _flushAgeMs;
+}
+
+/// <summary>
+/// Starts the background flush task, if not started, and
+/// registers flush() to run on esp_restart().
+/// </summary>
+void SDCard::beginFlushTask() {
+	if (_flushTask != nullptr) {
+		return;
+	}
+	_flushMutex = xSemaphoreCreateMutex();
+	if (xTaskCreate(flushTaskLoop, "SDCard flush", LOG_FLUSH_TASK_STACK,
+		this, 1, &_flushTask) != pdPASS) {
+		Serial.println("ERROR: SDCard could not create log flush task.");
+		_flushTask = nullptr;
+	}
+	_shutdownInstance = this;
+	esp_register_shutdown_handler(onShutdown);
+}
+
+/// <summary>
+/// Background task: waits until woken by a writer or until
+/// text may have aged past the threshold, then flushes if due.
+/// </summary>
+/// <param name="param">SDCard instance.</param>
+void SDCard::flushTaskLoop(void* param) {
+	SDCard* sd = (SDCard*)param;
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(sd->_flushAgeMs / 2 + 1));
+		if (sd->isFlushDue()) {
+			sd->flush();
+		}
+	}
+}
+
+/// <summary>
+/// Shutdown handler: writes buffered log text before restart.
+/// </summary>
+void SDCard::onShutdown() {
+	if (_shutdownInstance != nullptr) {
+		_shutdownInstance->flush();
+	}
+}
+
 /// <summary>
 /// Appends a line of data to the DATA file.
 /// </summary>
@@ -142,7 +279,7 @@ void SDCard::logData(String msg) {
 #endif
 	if (!_isBypassSDCard) {
 		String status = msg + "\r\n";	// Append CR + LF.
-		fileAppend(SD, LOGFILE_PATH_DATA.c_str(), status.c_str());
+		logWrite(_dataLog, status);
 	}
 }
 
@@ -157,7 +294,7 @@ void SDCard::logStatus_indent(const String& msg) {
 #endif
 	if (!_isBypassSDCard) {
 		String status = "\t" + msg + "\r\n";	// Append CR + LF.
-		fileAppend(SD, LOGFILE_PATH_STATUS.c_str(), status.c_str());
+		logWrite(_statusLog, status);
 	}
 }
 
@@ -169,7 +306,7 @@ void SDCard::logStatus() {
 	Serial.println();	// Echo to serial monitor
 #endif
 	if (!_isBypassSDCard) {
-		fileAppend(SD, LOGFILE_PATH_STATUS.c_str(), "\r\n");
+		logWrite(_statusLog, "\r\n");
 	}
 }
 
@@ -183,7 +320,7 @@ void SDCard::logStatus(const String& msg) {
 #endif
 	if (!_isBypassSDCard) {
 		String status = msg + "\r\n";	// Append CR + LF.
-		fileAppend(SD, LOGFILE_PATH_STATUS.c_str(), status.c_str());
+		logWrite(_statusLog, status);
 	}
 }
 
@@ -201,7 +338,7 @@ void SDCard::logStatus(const String& msg, const String& dateString) {
 #endif
 	if (!_isBypassSDCard) {
 		status += "\r\n";	// Append CR + LF.
-		fileAppend(SD, LOGFILE_PATH_STATUS.c_str(), status.c_str());
+		logWrite(_statusLog, status);
 	}
 }
 
@@ -219,7 +356,7 @@ void SDCard::logStatus(const String& msg, unsigned long millisec) {
 #endif
 	if (!_isBypassSDCard) {
 		status += "\r\n";	// Append CR + LF.
-		fileAppend(SD, LOGFILE_PATH_STATUS.c_str(), status.c_str());
+		logWrite(_statusLog, status);
 	}
 }
 
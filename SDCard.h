@@ -25,8 +25,18 @@ using namespace App_Settings;
 #include "FileOperations.h"
 using namespace FileOperations;
 
+#include "LogBuffer.h"
+#include "PhaseTimer.h"
+
 /// <summary>
 /// Exposes methods to read/write files to an SD card.
+///
+/// Log lines are added to RAM buffers and written to the card
+/// by a background task, a block at a time, when enough text is
+/// waiting or the oldest text is old enough. Call flush() to
+/// write them now. Buffers are also flushed by esp_restart().
+/// A brown-out or watchdog reset does not run any code, so up to
+/// the flush thresholds of log text can be lost then.
 /// </summary>
 class SDCard {
 
@@ -34,6 +44,35 @@ private:
 	int _SPI_CS_pin;	// SPI pin number for SD card.
 	bool _isBypassSDCard = false;
 
+	LogBuffer _statusLog{ LOG_BUFFER_SIZE_STATUS };	// Status lines waiting for card.
+	LogBuffer _dataLog{ LOG_BUFFER_SIZE_DATA };		// Data lines waiting for card.
+	unsigned int _flushBytes = LOG_FLUSH_BYTES;		// Flush when this many bytes waiting.
+	unsigned long _flushAgeMs = LOG_FLUSH_AGE_MS;	// Flush when oldest text is this old.
+	TaskHandle_t _flushTask = nullptr;				// Background flush task.
+	SemaphoreHandle_t _flushMutex = nullptr;		// Held while writing buffers to card.
+	PhaseTimer* _phaseTimer = nullptr;				// Times card writes, if set.
+
+	static SDCard* _shutdownInstance;	// Instance flushed by esp_restart().
+
+	/// <summary>
+	/// Adds text to a log buffer, waking the flush task
+	/// if enough text is waiting.
+	/// </summary>
+	void logWrite(LogBuffer& log, const String& text);
+
+	/// <summary>
+	/// Writes a log buffer to its file on the card.
+	/// </summary>
+	void flushLog(LogBuffer& log, const String& path);
+
+	/// <summary>
+	/// Starts the background flush task, if not started.
+	/// </summary>
+	void beginFlushTask();
+
+	static void flushTaskLoop(void* param);
+	static void onShutdown();
+
 	/*/// <summary>
 	/// Writes to the SD card file, overwriting existing data.
 	/// </summary>
@@ -74,6 +113,28 @@ public:
 	/// </summary>
 	void cancelBypass();
 
+	/// <summary>
+	/// Writes all buffered log text to the card now.
+	/// </summary>
+	void flush();
+
+	/// <summary>
+	/// Sets when the background task flushes buffered log text.
+	/// </summary>
+	/// <param name="flushBytes">Flush when this many bytes are waiting.</param>
+	/// <param name="flushAgeMs">Flush when oldest text is this old, ms.</param>
+	void setFlushThresholds(unsigned int flushBytes, unsigned long flushAgeMs);
+
+	/// <summary>
+	/// Returns true if buffered log text has reached a flush threshold.
+	/// </summary>
+	bool isFlushDue() const;
+
+	/// <summary>
+	/// Sets the timer that records the duration of each flush.
+	/// </summary>
+	void setPhaseTimer(PhaseTimer* phaseTimer) { _phaseTimer = phaseTimer; }
+
 	/// <summary>
 	/// Create the file if it does not exist.
 	/// </summary>
@@ -3,6 +3,7 @@
 // 
 
 #include "SensorData.h"
+#include <memory>
 
 /*****************************************************************
 	CONSTRUCTOR AND INITIALIZATION
@@ -29,10 +30,32 @@ SensorData::SensorData(
 	_isDatafile = isDataInFileSys;
 	_isReportDayMaxOnly = isReportDailyMaxOnly;
 	_isUseSmoothing = isUseSmoothing;
+	// Moving avg window has fixed capacity.
+	if (numInMovingAvg > SIZE_RAW_LIST) {
+		Serial.printf("ERROR: SensorData numInMovingAvg = %u exceeds %u.\n",
+			numInMovingAvg, (unsigned int)SIZE_RAW_LIST);
+		numInMovingAvg = SIZE_RAW_LIST;
+	}
 	_avgMoving_Num = numInMovingAvg;
+	_avg_moving_Window.setWindowSize(_avgMoving_Num);
 	_outlierDelta = outlierDelta;
 }
 
+/// <summary>
+/// Sets the value of one count in the 10-min and 60-min 
+/// lists, which hold values as int16 (default 0.01, for 
+/// +-327.67). Clears the lists, so set before adding data.
+/// Archived values are kept to the same resolution.
+/// </summary>
+/// <param name="scale">Value of one count, such as 0.1.</param>
+void SensorData::setSeriesScale(float scale) {
+	_data_10_min.setScale(scale);
+	_data_60_min.setScale(scale);
+	_archive_60_min.setResolution(scale);
+	_archive_dayMin.setResolution(scale);
+	_archive_dayMax.setResolution(scale);
+}
+
 /// <summary>
 /// Adds label information to the data.
 /// </summary>
@@ -110,7 +133,7 @@ void SensorData::addReading(dataPoint dp) {
 	/*
 	NOTE: If this is the first cycle, there's not yet
 	a value assigned to _avgMoving nor any data points
-	in _avg_moving_List.
+	in _avg_moving_Window.
 
 		_avgMoving = 0 (as initialized).
 
@@ -144,9 +167,9 @@ void SensorData::addReading(dataPoint dp) {
 			// Not an outlier, so include in 10-min avg.
 			_countReadings++;
 			_sumReadings += dp.value;
-			// Not an outlier, so include in moving avg.
-			addToList(_avg_moving_List, dp.value, _avgMoving_Num);
-			_avgMoving = listAverage(_avg_moving_List, _avgMoving_Num);
+			// Not an outlier, so include in moving avg (constant time).
+			_avg_moving_Window.add(dp.value);
+			_avgMoving = _avg_moving_Window.average();
 			_isMovingAvgStarted = true;
 		}
 	}
@@ -214,16 +237,28 @@ void SensorData::clearMinMax_day() {
 /// </summary>
 void SensorData::process_data_10_min() {
 	// Avg over last 10 min.
-	_avg_10_min = _sumReadings / _countReadings;
+	switch (_periodValue)
+	{
+	case PERIOD_VALUE_LAST:
+		_avg_10_min = _dataPointLastAdded.value;
+		break;
+	case PERIOD_VALUE_MAX:
+		_avg_10_min = (_max_10_min.value > -VAL_LIMIT) ? _max_10_min.value : 0;
+		break;
+	case PERIOD_VALUE_MIN:
+		_avg_10_min = (_min_10_min.value < VAL_LIMIT) ? _min_10_min.value : 0;
+		break;
+	default:
+		_avg_10_min = _sumReadings / _countReadings;
+		break;
+	}
 	// Add to 10-min list of observations.
 	addToList(_data_10_min,
 		dataPoint(_dataPointLastAdded.time, _avg_10_min),
 		SIZE_10_MIN_LIST);
 	// Store in LittleFS
 	if (_isDatafile) {
-		fileWrite(LittleFS,
-			sensorFilepath("_10_min").c_str(),
-			data_10_min_string().c_str());
+		_store_10_min.append(_data_10_min.back());
 	}
 	clear_10_min();	// Start another 10-min period.
 }
@@ -234,15 +269,28 @@ void SensorData::process_data_10_min() {
 /// </summary>
 void SensorData::process_data_60_min() {
 	// Average last 6 x 10 min and add to 60-min list.
-	_avg_60_min = listAverage(_data_10_min, 6);	// Save latest average.
+	switch (_periodValue)
+	{
+	case PERIOD_VALUE_LAST:
+		_avg_60_min = (_data_10_min.size() > 0) ? _data_10_min.back().value : 0;
+		break;
+	case PERIOD_VALUE_MAX:
+		_avg_60_min = listMaximum(_data_10_min, 6);
+		break;
+	case PERIOD_VALUE_MIN:
+		_avg_60_min = listMinimum(_data_10_min, 6);
+		break;
+	default:
+		_avg_60_min = listAverage(_data_10_min, 6);	// Save latest average.
+		break;
+	}
 	addToList(_data_60_min,
 		dataPoint(_dataPointLastAdded.time, _avg_60_min),
 		SIZE_60_MIN_LIST);
 	// Store in LittleFS
 	if (_isDatafile) {
-		fileWrite(LittleFS,
-			sensorFilepath("_60_min").c_str(),
-			data_60_min_string().c_str());
+		_store_60_min.append(_data_60_min.back());
+		_archive_60_min.append(_data_60_min.back());
 	}
 }
 
@@ -255,12 +303,35 @@ void SensorData::process_data_day() {
 	// Save list of daily minima and maxima.
 	addToList(_data_dayMin, _min_today, SIZE_DAY_LIST);
 	addToList(_data_dayMax, _max_today, SIZE_DAY_LIST);
-	clearMinMax_day();
 	// Store in LittleFS
 	if (_isDatafile) {
-		fileWrite(LittleFS,
-			sensorFilepath("_dayMaxMin").c_str(),
-			data_dayMaxMin_string().c_str());
+		_store_dayMin.append(_min_today);
+		_store_dayMax.append(_max_today);
+		_archive_dayMin.append(_min_today);
+		_archive_dayMax.append(_max_today);
+	}
+	clearMinMax_day();
+}
+
+/// <summary>
+/// Processes data at the end of a period.
+/// </summary>
+/// <param name="period">Period that has ended.</param>
+void SensorData::process_data(dataPeriod period) {
+
+	switch (period)
+	{
+	case App_Settings::PERIOD_10_MIN:
+		process_data_10_min();
+		break;
+	case App_Settings::PERIOD_60_MIN:
+		process_data_60_min();
+		break;
+	case App_Settings::PERIOD_DAY:
+		process_data_day();
+		break;
+	default:
+		break;
 	}
 }
 
@@ -275,41 +346,58 @@ void SensorData::process_data_day() {
 /// <param name="period">The type based on the period.</param>
 void SensorData::recover_data_fromFile(dataPeriod period) {
 
-	if (_isDatafile) {
-		String str;
-		switch (period)
-		{
-		case App_Settings::PERIOD_10_MIN:
-			// Get 10-min data from file system and place in memory.
-
-			// Read file from flash LittleFS.
-			str = fileRead(LittleFS, sensorFilepath("_10_min").c_str());
-			_data_10_min = listData_fromString(str);
-			break;
-		case App_Settings::PERIOD_60_MIN:
-			// Get 60-min data from file system and place in memory.
-			// Read file from flash LittleFS.
-			str = fileRead(LittleFS, sensorFilepath("_60_min").c_str());
-			_data_60_min = listData_fromString(str);
-
-			break;
-		case App_Settings::PERIOD_DAY:
-			// Get 10-min data from file system and place in memory.
-
-			// Read file from flash LittleFS.
-
+	switch (period)
+	{
+	case App_Settings::PERIOD_10_MIN:
+		data_10_min_fromFile();
+		break;
+	case App_Settings::PERIOD_60_MIN:
+		data_60_min_fromFile();
+		break;
+	case App_Settings::PERIOD_DAY:
+		data_dayMaxMin_fromFile();
+		break;
+	default:
+		break;
+	}
+}
 
-			data_dayMaxMin_fromFile();
+/// <summary>
+/// Fills a list from its binary store or, if the store is 
+/// empty (such as after upgrading from text files), from the 
+/// older text file.
+/// </summary>
+/// <param name="store">Binary store of the list.</param>
+/// <param name="targetList">List to fill.</param>
+/// <param name="fileSuffix">Suffix of the text file.</param>
+void SensorData::recoverList(SeriesStore& store, RingBuffer<dataPoint>& targetList, String fileSuffix) {
+	if (store.hasData()) {
+		store.load(targetList);
+	}
+	else if (LittleFS.exists(sensorFilepath(fileSuffix).c_str())) {
+		// Read text file from flash LittleFS.
+		String delim = fileRead(LittleFS, sensorFilepath(fileSuffix).c_str());
+		listData_fromString(delim, targetList);
+	}
+}
 
 
-			break;
-		default:
-			break;
-		}
+/// <summary>
+/// Fills a compact list from its binary store or text file.
+/// </summary>
+/// <param name="store">Binary store of the list.</param>
+/// <param name="targetList">List to fill.</param>
+/// <param name="fileSuffix">Suffix of the text file.</param>
+void SensorData::recoverList(SeriesStore& store, CompactSeries& targetList, String fileSuffix) {
+	// Recover as dataPoints, then pack. Only done at startup.
+	FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST + SIZE_60_MIN_LIST> points;
+	recoverList(store, points, fileSuffix);
+	targetList.clear();
+	for (const dataPoint& dp : points) {
+		addToList(targetList, dp, targetList.capacity());
 	}
 }
 
-
 /// <summary>
 /// Retrieves data points from file system and uses 
 /// them to initialize 10-min list in memory. Used to retrieve 
@@ -318,9 +406,7 @@ void SensorData::recover_data_fromFile(dataPeriod period) {
 void SensorData::data_10_min_fromFile() {
 	// Get 10-min data from file system and place in memory.
 	if (_isDatafile) {
-		// Read file from flash LittleFS.
-		String delim = fileRead(LittleFS, sensorFilepath("_10_min").c_str());
-		_data_10_min = listData_fromString(delim);
+		recoverList(_store_10_min, _data_10_min, "_10_min");
 	}
 }
 
@@ -330,11 +416,9 @@ void SensorData::data_10_min_fromFile() {
 /// any data lost at reboot.
 /// </summary>
 void SensorData::data_60_min_fromFile() {
-	// Get 10-min data from file system and place in memory.
+	// Get 60-min data from file system and place in memory.
 	if (_isDatafile) {
-		// Read file from flash LittleFS.
-		String delim = fileRead(LittleFS, sensorFilepath("_60_min").c_str());
-		_data_60_min = listData_fromString(delim);
+		recoverList(_store_60_min, _data_60_min, "_60_min");
 	}
 }
 
@@ -344,10 +428,17 @@ void SensorData::data_60_min_fromFile() {
 /// any data lost at reboot.
 /// </summary>
 void SensorData::data_dayMaxMin_fromFile() {
-	// Get 10-min data from file system and place in memory.
-	if (_isDatafile) {
-		// Read file from flash LittleFS.
-		String delim = fileRead(LittleFS, sensorFilepath("_10_min").c_str());
+	// Get day data from file system and place in memory.
+	if (!_isDatafile) {
+		return;
+	}
+	if (_store_dayMax.hasData()) {
+		_store_dayMax.load(_data_dayMax);
+		_store_dayMin.load(_data_dayMin);
+	}
+	else if (LittleFS.exists(sensorFilepath("_dayMaxMin").c_str())) {
+		// Read text file from flash LittleFS.
+		String delim = fileRead(LittleFS, sensorFilepath("_dayMaxMin").c_str());
 
 		list<String> parts = splitString(delim, '|');
 		int index = 0;
@@ -357,11 +448,11 @@ void SensorData::data_dayMaxMin_fromFile() {
 			switch (index) {
 			case 0:
 				// maxima list.
-				_data_dayMax = listData_fromString(s);
+				listData_fromString(s, _data_dayMax);
 				break;
 			case 1:
 				// minima list.							
-				_data_dayMin = listData_fromString(s);
+				listData_fromString(s, _data_dayMin);
 				break;
 			default:
 				// Unexpected index!
@@ -443,6 +534,78 @@ String SensorData::data_dayMin_string() {
 		_decimalPlaces);
 }
 
+/*****************************************************************
+	STREAMING WRITERS FROM MEMORY
+******************************************************************/
+
+/// <summary>
+/// Returns writer that streams the 10-min dataPoints in the 
+/// same format as data_10_min_string().
+/// </summary>
+SeriesWriter SensorData::data_10_min_writer() {
+	return SeriesWriter(_data_10_min, _isConvertZeroToEmpty, _decimalPlaces);
+}
+
+/// <summary>
+/// Returns writer that streams the 60-min dataPoints in the 
+/// same format as data_60_min_string().
+/// </summary>
+SeriesWriter SensorData::data_60_min_writer() {
+	return SeriesWriter(_data_60_min, _isConvertZeroToEmpty, _decimalPlaces);
+}
+
+/// <summary>
+/// Returns writer that streams daily maxima and minima in the 
+/// same format as data_dayMaxMin_string(). For some sensors, 
+/// only streams maxima without "|".
+/// </summary>
+SeriesWriter SensorData::data_dayMaxMin_writer() {
+	if (!_isReportDayMaxOnly) {
+		return SeriesWriter(_data_dayMax, _data_dayMin, _isConvertZeroToEmpty, _decimalPlaces);
+	}
+	else {
+		// Do not include minima in list.
+		return SeriesWriter(_data_dayMax, _isConvertZeroToEmpty, _decimalPlaces);
+	}
+}
+
+/// <summary>
+/// Returns writer that streams daily maxima in the 
+/// same format as data_dayMax_string().
+/// </summary>
+SeriesWriter SensorData::data_dayMax_writer() {
+	return SeriesWriter(_data_dayMax, _isConvertZeroToEmpty, _decimalPlaces);
+}
+
+/// <summary>
+/// Returns writer that streams daily minima in the 
+/// same format as data_dayMin_string().
+/// </summary>
+SeriesWriter SensorData::data_dayMin_writer() {
+	return SeriesWriter(_data_dayMin, _isConvertZeroToEmpty, _decimalPlaces);
+}
+
+/// <summary>
+/// Returns writer that streams the requested data series.
+/// </summary>
+/// <param name="series">Data series to write.</param>
+SeriesWriter SensorData::data_writer(dataSeries series) {
+	switch (series)
+	{
+	case App_Settings::SERIES_60_MIN:
+		return data_60_min_writer();
+	case App_Settings::SERIES_DAY_MAX_MIN:
+		return data_dayMaxMin_writer();
+	case App_Settings::SERIES_DAY_MAX:
+		return data_dayMax_writer();
+	case App_Settings::SERIES_DAY_MIN:
+		return data_dayMin_writer();
+	case App_Settings::SERIES_10_MIN:
+	default:
+		return data_10_min_writer();
+	}
+}
+
 /*****************************************************************
 	DELIMITED STRINGS FROM FILE SYSTEM
 ******************************************************************/
@@ -454,8 +617,9 @@ String SensorData::data_dayMin_string() {
 /// were saved in file system.</returns>
 String SensorData::data_10_min_stringFile() {
 	if (_isDatafile) {
-		// Read file from flash LittleFS.
-		return fileRead(LittleFS, sensorFilepath("_10_min").c_str());
+		FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST> stored;
+		recoverList(_store_10_min, stored, "_10_min");
+		return listToString_data(stored, _isConvertZeroToEmpty, _decimalPlaces);
 	}
 	else {
 		return "";
@@ -464,7 +628,9 @@ String SensorData::data_10_min_stringFile() {
 
 String SensorData::data_60_min_stringFile() {
 	if (_isDatafile) {
-		return fileRead(LittleFS, sensorFilepath("_60_min").c_str());
+		FixedRingBuffer<dataPoint, SIZE_60_MIN_LIST> stored;
+		recoverList(_store_60_min, stored, "_60_min");
+		return listToString_data(stored, _isConvertZeroToEmpty, _decimalPlaces);
 	}
 	else {
 		return "";
@@ -472,12 +638,55 @@ String SensorData::data_60_min_stringFile() {
 }
 
 String SensorData::data_dayMaxMin_stringFile() {
-	if (_isDatafile) {
+	if (!_isDatafile) {
+		return "";
+	}
+	if (!_store_dayMax.hasData()) {
+		// Older text file, if any.
 		return fileRead(LittleFS, sensorFilepath("_dayMaxMin").c_str());
 	}
-	else {
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> storedMax, storedMin;
+	_store_dayMax.load(storedMax);
+	if (_isReportDayMaxOnly) {
+		return listToString_data(storedMax, _isConvertZeroToEmpty, _decimalPlaces);
+	}
+	_store_dayMin.load(storedMin);
+	return listToString_data(storedMax, storedMin, _isConvertZeroToEmpty, _decimalPlaces);
+}
+
+/// <summary>
+/// Returns delimited String of archived data from a time to 
+/// a time, reduced to at most ARCHIVE_QUERY_POINTS points: 
+/// averages of 60-min values, or day maxima or minima.
+/// </summary>
+/// <param name="series">SERIES_60_MIN or a day series.</param>
+/// <param name="timeFrom">Earliest time.</param>
+/// <param name="timeTo">Latest time.</param>
+/// <returns>Delimited String of archived data.</returns>
+String SensorData::archive_string(dataSeries series, unsigned long timeFrom, unsigned long timeTo) {
+	typedef FixedRingBuffer<dataPoint, ARCHIVE_QUERY_POINTS> QueryList;
+	if (!_isDatafile || series == SERIES_10_MIN) {
 		return "";
 	}
+	// Lists are too large for the stack of a web server task.
+	std::unique_ptr<QueryList> points(new QueryList());
+	if (series == SERIES_60_MIN) {
+		// A span of gusts (last of period) is averaged; of peaks, the peak.
+		periodValue reduce = (_periodValue == PERIOD_VALUE_LAST) ? PERIOD_VALUE_AVERAGE : _periodValue;
+		_archive_60_min.query(timeFrom, timeTo, *points, reduce);
+		return listToString_data(*points, _isConvertZeroToEmpty, _decimalPlaces);
+	}
+	if (series == SERIES_DAY_MIN) {
+		_archive_dayMin.query(timeFrom, timeTo, *points, PERIOD_VALUE_MIN);
+		return listToString_data(*points, _isConvertZeroToEmpty, _decimalPlaces);
+	}
+	_archive_dayMax.query(timeFrom, timeTo, *points, PERIOD_VALUE_MAX);
+	if (series == SERIES_DAY_MAX || _isReportDayMaxOnly) {
+		return listToString_data(*points, _isConvertZeroToEmpty, _decimalPlaces);
+	}
+	std::unique_ptr<QueryList> minima(new QueryList());
+	_archive_dayMin.query(timeFrom, timeTo, *minima, PERIOD_VALUE_MIN);
+	return listToString_data(*points, *minima, _isConvertZeroToEmpty, _decimalPlaces);
 }
 
 /*****************************************************************
@@ -485,7 +694,9 @@ String SensorData::data_dayMaxMin_stringFile() {
 ******************************************************************/
 
 /// <summary>
-/// Creates files that hold sensor data points at various intervals.
+/// Opens (or creates) binary files that hold sensor data 
+/// points at various intervals. Text files from earlier 
+/// versions are left in place and read only for recovery.
 /// </summary>
 /// <param name="isConvertZeroToEmpty">
 /// Set to true to convert zero to empty in output strings.</param>
@@ -493,32 +704,55 @@ String SensorData::data_dayMaxMin_stringFile() {
 void SensorData::createFiles(bool isConvertZeroToEmpty, unsigned int decimalPlaces) {
 	_isConvertZeroToEmpty = isConvertZeroToEmpty;
 	_decimalPlaces = decimalPlaces;
+	bool isDir = LittleFS.mkdir(SENSOR_DATA_DIR_PATH);
 #if defined(VM_DEBUG)
-	if (LittleFS.mkdir(SENSOR_DATA_DIR_PATH)) {
-		Serial.printf("Created or found folder %s for %s.\n", SENSOR_DATA_DIR_PATH, _filenamePrefix);
+	if (isDir) {
+		Serial.printf("Created or found folder %s for %s.\n", SENSOR_DATA_DIR_PATH.c_str(), _filenamePrefix.c_str());
 	}
 	else {
-		Serial.printf("Failed to create or find folder %s for %s.\n", SENSOR_DATA_DIR_PATH, _filenamePrefix);
+		Serial.printf("Failed to create or find folder %s for %s.\n", SENSOR_DATA_DIR_PATH.c_str(), _filenamePrefix.c_str());
 	}
 #endif
-	if (!fileCreateOrExists(LittleFS, sensorFilepath("_10_min"))) {
-		Serial.printf("ERROR: Could not create or find %s", sensorFilepath("_10_min").c_str());
+	if (!_store_10_min.begin(LittleFS, sensorFilepath("_10_min", ".bin"), _filenamePrefix)) {
+		Serial.printf("ERROR: Could not create or find %s\n", sensorFilepath("_10_min", ".bin").c_str());
+	}
+	if (!_store_60_min.begin(LittleFS, sensorFilepath("_60_min", ".bin"), _filenamePrefix)) {
+		Serial.printf("ERROR: Could not create or find %s\n", sensorFilepath("_60_min", ".bin").c_str());
 	}
-	if (!fileCreateOrExists(LittleFS, sensorFilepath("_60_min"))) {
-		Serial.printf("ERROR: Could not create or find %s", sensorFilepath("_60_min").c_str());
+	if (!_store_dayMax.begin(LittleFS, sensorFilepath("_dayMax", ".bin"), _filenamePrefix)) {
+		Serial.printf("ERROR: Could not create or find %s\n", sensorFilepath("_dayMax", ".bin").c_str());
 	}
-	if (!fileCreateOrExists(LittleFS, sensorFilepath("_dayMaxMin"))) {
-		Serial.printf("ERROR: Could not create or find %s", sensorFilepath("_dayMaxMin"));
+	if (!_store_dayMin.begin(LittleFS, sensorFilepath("_dayMin", ".bin"), _filenamePrefix)) {
+		Serial.printf("ERROR: Could not create or find %s\n", sensorFilepath("_dayMin", ".bin").c_str());
 	}
 }
 
 /// <summary>
-/// Returns the path for a sensor data text file in LittleFS.
+/// Opens (or creates) the compressed archives of 60-min 
+/// values and day maxima and minima, which keep about a 
+/// year. Once open, period processing appends to them.
+/// </summary>
+void SensorData::createArchive() {
+	LittleFS.mkdir(SENSOR_DATA_DIR_PATH);
+	if (!_archive_60_min.begin(LittleFS, sensorFilepath("_60_min", ".arc"), _filenamePrefix)) {
+		Serial.printf("ERROR: Could not create or find %s\n", sensorFilepath("_60_min", ".arc").c_str());
+	}
+	if (!_archive_dayMax.begin(LittleFS, sensorFilepath("_dayMax", ".arc"), _filenamePrefix)) {
+		Serial.printf("ERROR: Could not create or find %s\n", sensorFilepath("_dayMax", ".arc").c_str());
+	}
+	if (!_archive_dayMin.begin(LittleFS, sensorFilepath("_dayMin", ".arc"), _filenamePrefix)) {
+		Serial.printf("ERROR: Could not create or find %s\n", sensorFilepath("_dayMin", ".arc").c_str());
+	}
+}
+
+/// <summary>
+/// Returns the path for a sensor data file in LittleFS.
 /// </summary>
 /// <param name="fileSuffix">A suffix to append to the file name.</param>
-/// <returns>Path to a sensor data .txt file.</returns>
-String SensorData::sensorFilepath(String fileSuffix) {
-	return SENSOR_DATA_DIR_PATH + "/" + _filenamePrefix + fileSuffix + ".txt";
+/// <param name="extension">File extension, such as ".txt".</param>
+/// <returns>Path to a sensor data file.</returns>
+String SensorData::sensorFilepath(String fileSuffix, String extension) {
+	return SENSOR_DATA_DIR_PATH + "/" + _filenamePrefix + fileSuffix + extension;
 }
 
 /*****************************************************************
@@ -689,6 +923,22 @@ float SensorData::avgMoving() {
 	return _avgMoving;
 }
 
+/// <summary>
+/// Returns minimum of the values in the moving average.
+/// </summary>
+/// <returns>Moving minimum.</returns>
+float SensorData::movingMin() {
+	return _avg_moving_Window.minimum();
+}
+
+/// <summary>
+/// Returns maximum of the values in the moving average.
+/// </summary>
+/// <returns>Moving maximum.</returns>
+float SensorData::movingMax() {
+	return _avg_moving_Window.maximum();
+}
+
 /// <summary>
 /// The last average saved to the 10-min list.
 /// </summary>
@@ -731,7 +981,7 @@ dataPoint SensorData::max_today() {
 /// List of (time, value) dataPoints at 10-min intervals.
 /// </summary>
 /// <returns>List of (time, value) dataPoints.</returns>
-list<dataPoint> SensorData::data_10_min() {
+const CompactSeries& SensorData::data_10_min() {
 	return _data_10_min;
 }
 
@@ -739,7 +989,7 @@ list<dataPoint> SensorData::data_10_min() {
 /// List of dataPoints at 60-min intervals.
 /// </summary>
 /// <returns></returns>
-list<dataPoint> SensorData::data_60_min() {
+const CompactSeries& SensorData::data_60_min() {
 	return _data_60_min;
 }
 
@@ -747,7 +997,7 @@ list<dataPoint> SensorData::data_60_min() {
 /// List of (time, value) dataPoints of daily minima.
 /// </summary>
 /// <returns>List of (time, value) dataPoints.</returns>
-list<dataPoint> SensorData::data_day_minima() {
+const RingBuffer<dataPoint>& SensorData::data_day_minima() {
 	return _data_dayMin;
 }
 
@@ -755,7 +1005,7 @@ list<dataPoint> SensorData::data_day_minima() {
 /// List of (time, value) dataPoints of daily maxima.
 /// </summary>
 /// <returns>List of (time, value) dataPoints.</returns>
-list<dataPoint> SensorData::data_day_maxima() {
+const RingBuffer<dataPoint>& SensorData::data_day_maxima() {
 	return _data_dayMax;
 }
 
@@ -12,6 +12,12 @@
 #include <list>
 using std::list;
 #include "dataPoint.h"
+#include "RingBuffer.h"
+#include "CompactSeries.h"
+#include "SlidingWindow.h"
+#include "SeriesWriter.h"
+#include "SeriesStore.h"
+#include "SeriesArchive.h"
 #include "ListFunctions.h"
 #include "App_settings.h"
 using namespace ListFunctions;
@@ -29,18 +35,19 @@ class SensorData {
 protected:		// Protected items are accessible by inherited classes.
 
 	/// <summary>
-	/// Returns a sensor data text-file path.
+	/// Returns a sensor data file path.
 	/// </summary>
 	/// <param name="fileSuffix">Suffix to append to file name.</param>
-	String sensorFilepath(String fileSuffix);
+	/// <param name="extension">File extension, such as ".txt".</param>
+	String sensorFilepath(String fileSuffix, String extension = ".txt");
 
 	String _label, _filenamePrefix;		// Identifying info.
 	String _units, _units_html;		// Units used.
 
 	dataPoint _dataPointLastAdded;		// Data point (time, value) of most recent reading.
 
-	float _sumReadings;				// Accumulating sum of readings.
-	unsigned int _countReadings;	// Number of readings in average.
+	float _sumReadings = 0;			// Accumulating sum of readings.
+	unsigned int _countReadings = 0;	// Number of readings in average.
 
 	// Samples required for smoothing avg.
 	const unsigned int COUNT_FOR_SMOOTH = 10;
@@ -80,10 +87,12 @@ protected:		// Protected items are accessible by inherited classes.
 	bool _isReportDayMaxOnly = false;	// Set true to save maxima but not minima on LittleFS file system.
 	bool _isUseSmoothing;				// Set true to smooth data with moving avg and reject outliers.
 	float _outlierDelta;				// Factor to determine if reading is an outlier.
-	list<float> _avg_moving_List;		// Moving avg of latest reading values.
+	SlidingWindow<SIZE_RAW_LIST> _avg_moving_Window;	// Moving avg, min, max of latest reading values.
 	float _avgMoving = 0;				// Moving average value.
 	unsigned int _avgMoving_Num;		// Maximum number of values to average.
 
+	periodValue _periodValue = PERIOD_VALUE_AVERAGE;	// Value saved for each 10-min and 60-min period.
+
 	bool _isConvertZeroToEmpty = true;	//
 	unsigned int _decimalPlaces = 0;	//
 
@@ -92,10 +101,39 @@ protected:		// Protected items are accessible by inherited classes.
 
 	bool isOutlier(dataPoint dp);
 
-	list<dataPoint> _data_10_min;		// List of Data_Points at 10-min intervals.
-	list<dataPoint> _data_60_min;		// List of Data_Points at 60-min intervals.
-	list<dataPoint> _data_dayMin;	// List of daily minima.
-	list<dataPoint> _data_dayMax;	// List of daily maxima.
+	// Lists at even intervals hold times by index and values as int16.
+	FixedCompactSeries<SIZE_10_MIN_LIST> _data_10_min{ SERIES_PERIOD_10_MIN_SEC };	// List of Data_Points at 10-min intervals.
+	FixedCompactSeries<SIZE_60_MIN_LIST> _data_60_min{ SERIES_PERIOD_60_MIN_SEC };	// List of Data_Points at 60-min intervals.
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> _data_dayMin;	// List of daily minima.
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> _data_dayMax;	// List of daily maxima.
+
+	// Binary files in LittleFS that hold the lists above.
+	SeriesStore _store_10_min{ SIZE_10_MIN_LIST };
+	SeriesStore _store_60_min{ SIZE_60_MIN_LIST };
+	SeriesStore _store_dayMin{ SIZE_DAY_LIST };
+	SeriesStore _store_dayMax{ SIZE_DAY_LIST };
+
+	// Compressed long-term archives in LittleFS, from createArchive().
+	SeriesArchive _archive_60_min{ ARCHIVE_60_MIN_BLOCKS };
+	SeriesArchive _archive_dayMin{ ARCHIVE_DAY_BLOCKS };
+	SeriesArchive _archive_dayMax{ ARCHIVE_DAY_BLOCKS };
+
+	/// <summary>
+	/// Fills a list from its binary store or, if the store is 
+	/// empty, from the older text file.
+	/// </summary>
+	/// <param name="store">Binary store of the list.</param>
+	/// <param name="targetList">List to fill.</param>
+	/// <param name="fileSuffix">Suffix of the text file.</param>
+	void recoverList(SeriesStore& store, RingBuffer<dataPoint>& targetList, String fileSuffix);
+
+	/// <summary>
+	/// Fills a compact list from its binary store or text file.
+	/// </summary>
+	/// <param name="store">Binary store of the list.</param>
+	/// <param name="targetList">List to fill.</param>
+	/// <param name="fileSuffix">Suffix of the text file.</param>
+	void recoverList(SeriesStore& store, CompactSeries& targetList, String fileSuffix);
 
 public:
 
@@ -112,7 +150,7 @@ public:
 	/// <param name="isUseMovingAvg">
 	/// Set true to smooth data.</param>
 	/// <param name="numSmoothPoints">
-	/// Number of points in moving avg.</param>
+	/// Number of points in moving avg (at most SIZE_RAW_LIST).</param>
 	/// <param name="outlierDelta">
 	/// Range applied to moving avg for outlier rejection.</param>
 	SensorData(bool isDataInFileSys = true,
@@ -122,8 +160,13 @@ public:
 		float outlierDelta = 1.75);
 
 	/// <summary>
-	/// Creates files that hold sensor data points at various 
-	/// intervals.
+	/// Virtual, as subclasses override process_data().
+	/// </summary>
+	virtual ~SensorData() = default;
+
+	/// <summary>
+	/// Opens (or creates) binary files that hold sensor data 
+	/// points at various intervals.
 	/// </summary>
 	/// <param name="isConvertZeroToEmpty">
 	/// Set to true to convert zero to empty in output strings.
@@ -133,6 +176,30 @@ public:
 	void createFiles(bool isConvertZeroToEmpty = true,
 		unsigned int decimalPlaces = 0);
 
+	/// <summary>
+	/// Opens (or creates) the compressed archives of 60-min 
+	/// values and day maxima and minima, which keep about a 
+	/// year. Once open, period processing appends to them.
+	/// </summary>
+	void createArchive();
+
+	/// <summary>
+	/// Sets what is saved as the value of each 10-min period:
+	/// the average, last or largest reading. A 60-min period 
+	/// gets the average, last or largest of its 10-min values.
+	/// </summary>
+	/// <param name="value">Value to save (default average).</param>
+	void setPeriodValue(periodValue value) { _periodValue = value; }
+
+	/// <summary>
+	/// Sets the value of one count in the 10-min and 60-min 
+	/// lists, which hold values as int16 (default 0.01, for 
+	/// +-327.67). Clears the lists, so set before adding data.
+	/// Archived values are kept to the same resolution.
+	/// </summary>
+	/// <param name="scale">Value of one count, such as 0.1.</param>
+	void setSeriesScale(float scale);
+
 	/// <summary>
 	/// Adds (time, value) dataPoint, accumulates average, 
 	/// and processes min, max.
@@ -160,6 +227,12 @@ public:
 	void process_data_day();
 
 
+	/// <summary>
+	/// Processes data at the end of a period.
+	/// </summary>
+	/// <param name="period">Period that has ended.</param>
+	virtual void process_data(dataPeriod period);
+
 	/// <summary>
 	/// Recovers list of data points from a file.
 	/// </summary>
@@ -193,6 +266,18 @@ public:
 	/// <returns>Moving average.</returns>
 	float avgMoving();
 
+	/// <summary>
+	/// Returns minimum of the values in the moving average.
+	/// </summary>
+	/// <returns>Moving minimum.</returns>
+	float movingMin();
+
+	/// <summary>
+	/// Returns maximum of the values in the moving average.
+	/// </summary>
+	/// <returns>Moving maximum.</returns>
+	float movingMax();
+
 	/// <summary>
 	/// The last average saved to the 10-min list.
 	/// </summary>
@@ -254,25 +339,25 @@ public:
 	/// List of (time, value) dataPoints at 10-min intervals.
 	/// </summary>
 	/// <returns>List of (time, value) dataPoints.</returns>
-	list<dataPoint> data_10_min();
+	const CompactSeries& data_10_min();
 
 	/// <summary>
 	/// List of (time, value) dataPoints at 60-min intervals.
 	/// </summary>
 	/// <returns>List of (time, value) dataPoints.</returns>
-	list<dataPoint> data_60_min();
+	const CompactSeries& data_60_min();
 
 	/// <summary>
 	/// List of (time, value) dataPoints of daily minima.
 	/// </summary>
 	/// <returns>List of (time, value) dataPoints.</returns>
-	list<dataPoint> data_day_minima();
+	const RingBuffer<dataPoint>& data_day_minima();
 
 	/// <summary>
 	/// List of (time, value) dataPoints of daily maxima.
 	/// </summary>
 	/// <returns>List of (time, value) dataPoints.</returns>
-	list<dataPoint> data_day_maxima();
+	const RingBuffer<dataPoint>& data_day_maxima();
 
 	/// <summary>
 	/// Adds label information to the data.
@@ -354,6 +439,42 @@ public:
 	/// </summary>
 	String data_dayMin_string();
 
+	/// <summary>
+	/// Returns writer that streams the 10-min dataPoints in the 
+	/// same format as data_10_min_string().
+	/// </summary>
+	SeriesWriter data_10_min_writer();
+
+	/// <summary>
+	/// Returns writer that streams the 60-min dataPoints in the 
+	/// same format as data_60_min_string().
+	/// </summary>
+	SeriesWriter data_60_min_writer();
+
+	/// <summary>
+	/// Returns writer that streams daily maxima and minima in the 
+	/// same format as data_dayMaxMin_string().
+	/// </summary>
+	SeriesWriter data_dayMaxMin_writer();
+
+	/// <summary>
+	/// Returns writer that streams daily maxima in the 
+	/// same format as data_dayMax_string().
+	/// </summary>
+	SeriesWriter data_dayMax_writer();
+
+	/// <summary>
+	/// Returns writer that streams daily minima in the 
+	/// same format as data_dayMin_string().
+	/// </summary>
+	SeriesWriter data_dayMin_writer();
+
+	/// <summary>
+	/// Returns writer that streams the requested data series.
+	/// </summary>
+	/// <param name="series">Data series to write.</param>
+	SeriesWriter data_writer(dataSeries series);
+
 
 	/******     DATA FROM FILE SYSTEM     ******/
 
@@ -402,6 +523,17 @@ public:
 	/// <returns>Delimited String of data data</returns>
 	String data_dayMaxMin_stringFile();
 
+	/// <summary>
+	/// Returns delimited String of archived data from a time to 
+	/// a time, reduced to at most ARCHIVE_QUERY_POINTS points: 
+	/// averages of 60-min values, or day maxima or minima.
+	/// </summary>
+	/// <param name="series">SERIES_60_MIN or a day series.</param>
+	/// <param name="timeFrom">Earliest time.</param>
+	/// <param name="timeTo">Latest time.</param>
+	/// <returns>Delimited String of archived data.</returns>
+	String archive_string(dataSeries series, unsigned long timeFrom, unsigned long timeTo);
+
 	/******     DUMMY DATA     ******/
 
 	void addDummy_data_10_min(float valueStart, 
@@ -0,0 +1,133 @@
+// 
+// 
+// 
+
+#include "SensorRegistry.h"
+
+/// <summary>
+/// Adds labels to a sensor and registers it.
+/// </summary>
+/// <param name="sensor">Sensor instance.</param>
+/// <param name="label">Display label.</param>
+/// <param name="filenamePrefix">Text that begins data file name;
+/// also the sensor's short name.</param>
+/// <param name="units">Data units.</param>
+/// <param name="units_html">Data units with html encoding,
+/// or empty to use units.</param>
+/// <param name="chart">Chart fed by sensor, or CHART_NONE.</param>
+/// <param name="roles">sensorRole flags.</param>
+/// <returns>False if the registry is full.</returns>
+bool SensorRegistry::add(SensorData& sensor,
+	const String& label,
+	const String& filenamePrefix,
+	const String& units,
+	const String& units_html,
+	chartRequested chart,
+	uint8_t roles)
+{
+	if (_count >= SENSOR_REGISTRY_SIZE) {
+		Serial.printf("ERROR: SensorRegistry is full; %s not added.\n", label.c_str());
+		return false;
+	}
+	if (units_html.length() > 0) {
+		sensor.addLabels(label, filenamePrefix, units, units_html);
+	}
+	else {
+		sensor.addLabels(label, filenamePrefix, units);
+	}
+	Entry& entry = _entries[_count++];
+	entry.sensor = &sensor;
+	entry.chart = chart;
+	entry.roles = roles;
+	return true;
+}
+
+/// <summary>
+/// Returns the sensor that feeds a chart, or nullptr.
+/// </summary>
+const SensorRegistry::Entry* SensorRegistry::find(chartRequested chart) const {
+	if (chart == CHART_NONE) {
+		return nullptr;
+	}
+	for (const Entry& entry : *this) {
+		if (entry.chart == chart) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+/// <summary>
+/// Returns the sensor with a short name (file name
+/// prefix), or nullptr.
+/// </summary>
+const SensorRegistry::Entry* SensorRegistry::find(const String& filenamePrefix) const {
+	for (const Entry& entry : *this) {
+		if (entry.sensor->filenamePrefix() == filenamePrefix) {
+			return &entry;
+		}
+	}
+	return nullptr;
+}
+
+/// <summary>
+/// Returns the role that selects sensors for a period.
+/// </summary>
+uint8_t SensorRegistry::periodRole(dataPeriod period) {
+	switch (period)
+	{
+	case App_Settings::PERIOD_10_MIN:
+		return ROLE_10_MIN;
+	case App_Settings::PERIOD_60_MIN:
+		return ROLE_60_MIN;
+	case App_Settings::PERIOD_DAY:
+		return ROLE_DAY;
+	default:
+		return ROLE_NONE;
+	}
+}
+
+/// <summary>
+/// Processes data of the sensors with the period's role.
+/// </summary>
+/// <param name="period">Period that has ended.</param>
+void SensorRegistry::process(dataPeriod period) {
+	uint8_t role = periodRole(period);
+	for (const Entry& entry : *this) {
+		if (role != ROLE_NONE && entry.hasRole(role)) {
+			entry.sensor->process_data(period);
+		}
+	}
+}
+
+/// <summary>
+/// Opens (or creates) data files of the sensors with ROLE_FILES,
+/// and archives of those also with ROLE_ARCHIVE.
+/// </summary>
+void SensorRegistry::createFiles() {
+	for (const Entry& entry : *this) {
+		if (entry.hasRole(ROLE_FILES)) {
+			entry.sensor->createFiles();
+		}
+		if (entry.hasRole(ROLE_FILES | ROLE_ARCHIVE)) {
+			entry.sensor->createArchive();
+		}
+	}
+}
+
+/// <summary>
+/// Recovers a period's data from files, for the sensors
+/// with ROLE_FILES.
+/// </summary>
+/// <param name="period">Period of data to recover.</param>
+/// <returns>Number of sensors recovered.</returns>
+unsigned int SensorRegistry::recover(dataPeriod period) {
+	unsigned int count = 0;
+	for (const Entry& entry : *this) {
+		if (entry.hasRole(ROLE_FILES) && entry.sensor->isDatafile()) {
+			entry.sensor->recover_data_fromFile(period);
+			count++;
+		}
+	}
+	return count;
+}
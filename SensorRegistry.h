@@ -0,0 +1,124 @@
+// SensorRegistry.h
+
+#ifndef _SENSORREGISTRY_h
+#define _SENSORREGISTRY_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "App_settings.h"
+#include "SensorData.h"
+
+/// <summary>
+/// Table of the SensorData instances, with what is done with
+/// each one: periods processed, data files kept, and the chart
+/// it feeds. Period processing, file creation, data recovery
+/// and chart data routes loop over the table, so adding a
+/// sensor is one add() call.
+/// </summary>
+class SensorRegistry {
+
+public:
+
+	/// <summary>
+	/// What is done with a registered sensor (combine with |).
+	/// </summary>
+	enum sensorRole : uint8_t {
+		ROLE_NONE = 0,
+		ROLE_10_MIN = 0x01,			// Process 10-min averages.
+		ROLE_60_MIN = 0x02,			// Process 60-min averages.
+		ROLE_DAY = 0x04,			// Process day maxima and minima.
+		ROLE_FILES = 0x08,			// Keep data files in LittleFS.
+		ROLE_CHART_MAX_MIN = 0x10,	// Chart shows day maxima with minima.
+		ROLE_ARCHIVE = 0x20,		// Keep compressed long-term archive (with ROLE_FILES).
+		ROLE_ALL = 0x3F
+	};
+
+	/// <summary>
+	/// A registered sensor.
+	/// </summary>
+	struct Entry {
+		SensorData* sensor;			// Sensor instance.
+		chartRequested chart;		// Chart fed by sensor, or CHART_NONE.
+		uint8_t roles;				// sensorRole flags.
+
+		bool hasRole(uint8_t role) const { return (roles & role) == role; }
+
+		/// <summary>
+		/// Returns true if the sensor's chart has the data series.
+		/// </summary>
+		bool hasSeries(dataSeries series) const {
+			return chart != CHART_NONE
+				&& (series != SERIES_DAY_MAX_MIN || hasRole(ROLE_CHART_MAX_MIN));
+		}
+	};
+
+	/// <summary>
+	/// Adds labels to a sensor and registers it.
+	/// </summary>
+	/// <param name="sensor">Sensor instance.</param>
+	/// <param name="label">Display label.</param>
+	/// <param name="filenamePrefix">Text that begins data file name;
+	/// also the sensor's short name.</param>
+	/// <param name="units">Data units.</param>
+	/// <param name="units_html">Data units with html encoding,
+	/// or empty to use units.</param>
+	/// <param name="chart">Chart fed by sensor, or CHART_NONE.</param>
+	/// <param name="roles">sensorRole flags.</param>
+	/// <returns>False if the registry is full.</returns>
+	bool add(SensorData& sensor,
+		const String& label,
+		const String& filenamePrefix,
+		const String& units,
+		const String& units_html,
+		chartRequested chart,
+		uint8_t roles);
+
+	/// <summary>
+	/// Returns the sensor that feeds a chart, or nullptr.
+	/// </summary>
+	const Entry* find(chartRequested chart) const;
+
+	/// <summary>
+	/// Returns the sensor with a short name (file name
+	/// prefix), or nullptr.
+	/// </summary>
+	const Entry* find(const String& filenamePrefix) const;
+
+	/// <summary>
+	/// Processes data of the sensors with the period's role.
+	/// </summary>
+	/// <param name="period">Period that has ended.</param>
+	void process(dataPeriod period);
+
+	/// <summary>
+	/// Opens (or creates) data files of the sensors with ROLE_FILES,
+	/// and archives of those also with ROLE_ARCHIVE.
+	/// </summary>
+	void createFiles();
+
+	/// <summary>
+	/// Recovers a period's data from files, for the sensors
+	/// with ROLE_FILES.
+	/// </summary>
+	/// <param name="period">Period of data to recover.</param>
+	/// <returns>Number of sensors recovered.</returns>
+	unsigned int recover(dataPeriod period);
+
+	unsigned int size() const { return _count; }
+	const Entry& operator[](unsigned int index) const { return _entries[index]; }
+	const Entry* begin() const { return _entries; }
+	const Entry* end() const { return _entries + _count; }
+
+private:
+
+	Entry _entries[SENSOR_REGISTRY_SIZE];	// Registered sensors, in processing order.
+	unsigned int _count = 0;				// Number registered.
+
+	static uint8_t periodRole(dataPeriod period);
+};
+
+#endif
@@ -0,0 +1,93 @@
+// 
+// 
+// 
+
+#include "SensorScheduler.h"
+
+/// <summary>
+/// Adds a sensor read to the schedule.
+/// </summary>
+/// <param name="name">Sensor name.</param>
+/// <param name="read">Function that reads the sensor.</param>
+/// <param name="period">Base periods between reads (1 = every tick).</param>
+/// <param name="phase">Tick within period on which to read (less than period).</param>
+/// <param name="timedPhase">Phase to time the read as, or PHASE_COUNT.</param>
+/// <returns>False if the schedule is full or period and phase are not valid.</returns>
+bool SensorScheduler::add(const char* name,
+	readFunction read,
+	unsigned int period,
+	unsigned int phase,
+	loopPhase timedPhase)
+{
+	if (_count >= App_Settings::SENSOR_SCHEDULE_SIZE) {
+		Serial.printf("ERROR: SensorScheduler is full; %s not added.\n", name);
+		return false;
+	}
+	if (read == nullptr || period == 0 || phase >= period || period > UINT16_MAX) {
+		Serial.printf("ERROR: SensorScheduler period %u, phase %u not valid; %s not added.\n",
+			period, phase, name);
+		return false;
+	}
+	Entry& entry = _entries[_count++];
+	entry.name = name;
+	entry.read = read;
+	entry.period = period;
+	entry.phase = phase;
+	entry.timedPhase = timedPhase;
+	return true;
+}
+
+/// <summary>
+/// Reads the sensors due on this tick, then advances to the next tick.
+/// Call once for each handled base period.
+/// </summary>
+/// <param name="sample">Takes the readings.</param>
+/// <param name="timer">Records the duration of timed reads, if not nullptr.</param>
+/// <returns>Number of sensors read.</returns>
+unsigned int SensorScheduler::tick(TickSample& sample, PhaseTimer* timer) {
+	unsigned int numRead = 0;
+	for (unsigned int i = 0; i < _count; i++) {
+		const Entry& entry = _entries[i];
+		if (!entry.isDue(_tick)) {
+			continue;
+		}
+		unsigned long timeStart = PhaseTimer::start();
+		entry.read(sample);
+		if (timer != nullptr) {
+			timer->stop(entry.timedPhase, timeStart);
+		}
+		numRead++;
+	}
+	_tick++;
+	return numRead;
+}
+
+/// <summary>
+/// Returns the number of sensor reads due on a tick.
+/// </summary>
+unsigned int SensorScheduler::countDue(unsigned long tick) const {
+	unsigned int numDue = 0;
+	for (unsigned int i = 0; i < _count; i++) {
+		numDue += _entries[i].isDue(tick);
+	}
+	return numDue;
+}
+
+/// <summary>
+/// Returns the most sensor reads due on any one tick.
+/// The schedule repeats every 24 hours at most, as periods
+/// should divide BASE_PERIODS_IN_10_MIN.
+/// </summary>
+unsigned int SensorScheduler::maxDue() const {
+	unsigned int maxDue = 0;
+	for (unsigned long tick = 0; tick < App_Settings::BASE_PERIODS_IN_24_HR; tick++) {
+		unsigned int numDue = countDue(tick);
+		if (numDue > maxDue) {
+			maxDue = numDue;
+		}
+		if (maxDue == _count) {
+			break;
+		}
+	}
+	return maxDue;
+}
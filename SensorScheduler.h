@@ -0,0 +1,99 @@
+// SensorScheduler.h
+
+#ifndef _SENSORSCHEDULER_h
+#define _SENSORSCHEDULER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "App_settings.h"
+#include "PhaseTimer.h"
+#include "TickSample.h"
+
+/// <summary>
+/// Table of sensor read functions, each with a period and phase
+/// in base periods. A read is due on ticks where
+/// tick % period == phase, so slow sensors with the same period
+/// and different phases are read on different ticks, and no
+/// single tick waits on all of them. Reads add their readings
+/// to the tick's TickSample.
+/// </summary>
+class SensorScheduler {
+
+public:
+
+	typedef void(*readFunction)(TickSample& sample);
+
+	/// <summary>
+	/// A scheduled sensor read.
+	/// </summary>
+	struct Entry {
+		const char* name;		// Sensor name, for the status log.
+		readFunction read;		// Reads the sensor and adds its readings to the sample.
+		uint16_t period;		// Base periods between reads.
+		uint16_t phase;			// Tick within period on which to read.
+		loopPhase timedPhase;	// Phase timed by PhaseTimer, or PHASE_COUNT.
+
+		bool isDue(unsigned long tick) const { return tick % period == phase; }
+	};
+
+	/// <summary>
+	/// Adds a sensor read to the schedule.
+	/// </summary>
+	/// <param name="name">Sensor name.</param>
+	/// <param name="read">Function that reads the sensor.</param>
+	/// <param name="period">Base periods between reads (1 = every tick).</param>
+	/// <param name="phase">Tick within period on which to read (less than period).</param>
+	/// <param name="timedPhase">Phase to time the read as, or PHASE_COUNT.</param>
+	/// <returns>False if the schedule is full or period and phase are not valid.</returns>
+	bool add(const char* name,
+		readFunction read,
+		unsigned int period,
+		unsigned int phase,
+		loopPhase timedPhase = PHASE_COUNT);
+
+	/// <summary>
+	/// Reads the sensors due on this tick, then advances to the next tick.
+	/// Call once for each handled base period.
+	/// </summary>
+	/// <param name="sample">Takes the readings.</param>
+	/// <param name="timer">Records the duration of timed reads, if not nullptr.</param>
+	/// <returns>Number of sensors read.</returns>
+	unsigned int tick(TickSample& sample, PhaseTimer* timer = nullptr);
+
+	/// <summary>
+	/// Returns the number of sensor reads due on a tick.
+	/// </summary>
+	unsigned int countDue(unsigned long tick) const;
+
+	/// <summary>
+	/// Returns the most sensor reads due on any one tick.
+	/// </summary>
+	unsigned int maxDue() const;
+
+	/// <summary>
+	/// Returns the number of ticks run.
+	/// </summary>
+	unsigned long ticks() const { return _tick; }
+
+	/// <summary>
+	/// Returns the number of scheduled reads.
+	/// </summary>
+	unsigned int count() const { return _count; }
+
+	/// <summary>
+	/// Returns a scheduled read by index (0 to count() - 1).
+	/// </summary>
+	const Entry& entry(unsigned int index) const { return _entries[index]; }
+
+private:
+
+	Entry _entries[App_Settings::SENSOR_SCHEDULE_SIZE];
+	unsigned int _count = 0;
+	unsigned long _tick = 0;	// Tick to run next.
+};
+
+#endif
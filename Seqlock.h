@@ -0,0 +1,116 @@
+// Seqlock.h
+
+#ifndef _SEQLOCK_h
+#define _SEQLOCK_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <atomic>
+
+/// <summary>
+/// Sequence counter for data with one writer task and any
+/// number of readers, which never block the writer. The writer
+/// brackets its changes with beginWrite() and endWrite(), which
+/// leave the count odd while it writes. A reader takes
+/// readBegin(), copies the data, and must discard the copy and
+/// try again if readRetry() returns true.
+/// </summary>
+class SeqCounter {
+
+	std::atomic<unsigned int> _seq{ 0 };	// Odd while writing.
+
+public:
+
+	/// <summary>
+	/// Marks the data as being written. Writer only.
+	/// </summary>
+	void beginWrite() {
+		_seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);	// Odd count before data.
+	}
+
+	/// <summary>
+	/// Marks the data as written. Writer only.
+	/// </summary>
+	void endWrite() {
+		_seq.store(_seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+	}
+
+	/// <summary>
+	/// Returns the count to pass to readRetry() after copying
+	/// the data. An odd count means a write is under way.
+	/// </summary>
+	unsigned int readBegin() const { return _seq.load(std::memory_order_acquire); }
+
+	/// <summary>
+	/// Returns true if the data copied since readBegin() may
+	/// be torn, because a write was under way or has been made.
+	/// </summary>
+	/// <param name="seq">Count from readBegin().</param>
+	bool readRetry(unsigned int seq) const {
+		std::atomic_thread_fence(std::memory_order_acquire);	// Data before count.
+		return (seq & 1) != 0 || _seq.load(std::memory_order_relaxed) != seq;
+	}
+
+	/// <summary>
+	/// Returns the number of completed writes.
+	/// </summary>
+	unsigned int writes() const { return _seq.load(std::memory_order_acquire) / 2; }
+};
+
+/// <summary>
+/// A value published by one writer task and read by other
+/// tasks, on either core, without locks. write() copies the
+/// value in a short critical section, so a reader on the
+/// writer's core can never preempt a half-done write and spin
+/// on it; a reader on the other core retries for at most the
+/// time of one copy. T must be a plain struct (no pointers to
+/// memory that the writer frees or reuses).
+/// </summary>
+template <typename T>
+class Seqlock {
+
+	T _value;
+	SeqCounter _seq;
+	portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+
+public:
+
+	Seqlock() : _value() {}
+
+	/// <summary>
+	/// Publishes a value. Writer only.
+	/// </summary>
+	/// <param name="value">Value to publish.</param>
+	void write(const T& value) {
+		portENTER_CRITICAL(&_mux);
+		_seq.beginWrite();
+		_value = value;
+		_seq.endWrite();
+		portEXIT_CRITICAL(&_mux);
+	}
+
+	/// <summary>
+	/// Returns a copy of the last value published.
+	/// </summary>
+	T read() const {
+		T value;
+		unsigned int seq;
+		do {
+			seq = _seq.readBegin();
+			value = _value;
+		} while (_seq.readRetry(seq));
+		return value;
+	}
+
+	/// <summary>
+	/// Returns the number of values published.
+	/// </summary>
+	unsigned int version() const { return _seq.writes(); }
+};
+
+#endif
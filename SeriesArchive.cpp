@@ -0,0 +1,510 @@
+// 
+// 
+// 
+
+#include "SeriesArchive.h"
+#include "Utilities.h"
+
+const uint32_t SeriesArchive::MAGIC;
+const uint16_t SeriesArchive::VERSION;
+const unsigned int SeriesArchive::SENSOR_ID_SIZE;
+const unsigned int SeriesArchive::BLOCK_DATA_SIZE;
+
+// File layout must not depend on compiler padding.
+static_assert(sizeof(SeriesArchive::Header) == 32, "SeriesArchive::Header layout");
+static_assert(sizeof(SeriesArchive::Block) == ARCHIVE_BLOCK_SIZE, "SeriesArchive::Block layout");
+
+static const unsigned int RAW_BITS = 32;	// Bits of a time or value sent as is.
+static const unsigned int BITS_CAPACITY = 8 * SeriesArchive::BLOCK_DATA_SIZE;
+
+/// <summary>
+/// Time step changes (delta-of-delta) by size: a change that fits
+/// in a bucket's bits is sent as the bucket's prefix, then the bits.
+/// A change of 0 is a single 0 bit.
+/// </summary>
+static const struct {
+	uint8_t prefix;			// Prefix bits, such as 0b110.
+	uint8_t prefixBits;		// Bits in prefix.
+	uint8_t valueBits;		// Bits of signed change.
+} DOD_BUCKETS[] = {
+	{ 0b10, 2, 7 },			// +-64 s.
+	{ 0b110, 3, 9 },		// +-256 s.
+	{ 0b1110, 4, 12 },		// +-34 min.
+	{ 0b11110, 5, 20 },		// +-6 days, such as times of day extremes.
+	{ 0b11111, 5, RAW_BITS }
+};
+
+/// <summary>
+/// Adds bits to block data after bitCount, if they fit.
+/// Data after bitCount must be zero.
+/// </summary>
+/// <param name="block">Block to write.</param>
+/// <param name="bitCount">Bits used; advanced by numBits.</param>
+/// <param name="value">Bits to add, in the low numBits.</param>
+/// <param name="numBits">Number of bits, 1 to 32.</param>
+/// <returns>False if the bits do not fit.</returns>
+static bool writeBits(SeriesArchive::Block& block, unsigned int& bitCount, uint32_t value, unsigned int numBits) {
+	if (bitCount + numBits > BITS_CAPACITY) {
+		return false;
+	}
+	for (int bit = numBits - 1; bit >= 0; bit--) {
+		if ((value >> bit) & 1) {
+			block.data[bitCount / 8] |= 0x80 >> (bitCount % 8);
+		}
+		bitCount++;
+	}
+	return true;
+}
+
+/// <summary>
+/// Reads bits from block data.
+/// </summary>
+/// <param name="block">Block to read.</param>
+/// <param name="bitIndex">Bit to read first; advanced by numBits.</param>
+/// <param name="numBits">Number of bits, 1 to 32.</param>
+/// <returns>Bits read, in the low numBits.</returns>
+static uint32_t readBits(const SeriesArchive::Block& block, unsigned int& bitIndex, unsigned int numBits) {
+	uint32_t value = 0;
+	for (unsigned int i = 0; i < numBits; i++, bitIndex++) {
+		value = (value << 1) | ((block.data[bitIndex / 8] >> (7 - bitIndex % 8)) & 1);
+	}
+	return value;
+}
+
+/// <summary>
+/// Returns a signed value from its low numBits.
+/// </summary>
+static int32_t signExtend(uint32_t value, unsigned int numBits) {
+	if (numBits >= 32) {
+		return (int32_t)value;
+	}
+	uint32_t signBit = 1UL << (numBits - 1);
+	value &= (signBit << 1) - 1;
+	return (int32_t)((value ^ signBit) - signBit);
+}
+
+/// <summary>
+/// Returns the float with the bits.
+/// </summary>
+static float bitsToFloat(uint32_t bits) {
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+/// <summary>
+/// Creates an archive of a number of blocks.
+/// </summary>
+/// <param name="blockCount">Blocks in file (at least 2).</param>
+/// <param name="resolution">Values are kept to within half of this.</param>
+SeriesArchive::SeriesArchive(unsigned int blockCount, float resolution) {
+	// Two blocks at least, so one remains while the newest fills.
+	_blockCount = std::max(2U, blockCount);
+	memset(&_state, 0, sizeof(_state));
+	setResolution(resolution);
+}
+
+/// <summary>
+/// Sets the resolution of values appended from now on.
+/// </summary>
+/// <param name="resolution">Values are kept to within half of
+/// this; 0 keeps them exactly.</param>
+void SeriesArchive::setResolution(float resolution) {
+	// The largest power of 2 not above the resolution.
+	_resolutionExp = (resolution > 0) ? (int)floorf(log2f(resolution)) : -1000;
+}
+
+/// <summary>
+/// Returns the bits of a value, rounded to the resolution by
+/// clearing the mantissa bits below it.
+/// </summary>
+uint32_t SeriesArchive::roundedBits(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	int exponent = (int)((bits >> 23) & 0xFF) - 127;
+	if (exponent == 128 || (bits & 0x7FFFFFFF) == 0) {
+		return bits;	// Infinity, NaN or zero.
+	}
+	// Mantissa bits for steps of 2^_resolutionExp.
+	int keep = std::max(0, std::min(23, exponent - _resolutionExp));
+	int drop = 23 - keep;
+	if (drop > 0) {
+		// Round to nearest; a carry into the exponent is still right.
+		bits += 1UL << (drop - 1);
+		bits &= ~((1UL << drop) - 1);
+	}
+	return bits;
+}
+
+/// <summary>
+/// Returns the file offset of the block slot used by a sequence number.
+/// </summary>
+size_t SeriesArchive::blockOffset(uint32_t seq) {
+	return sizeof(Header) + (seq % _blockCount) * sizeof(Block);
+}
+
+/// <summary>
+/// Opens the archive file, creating it if it is missing or
+/// was written with a different layout or sensor id.
+/// </summary>
+/// <param name="fs">File system to use.</param>
+/// <param name="path">Archive file path.</param>
+/// <param name="sensorId">Sensor id saved in header.</param>
+/// <returns>True if the archive is ready for use.</returns>
+bool SeriesArchive::begin(fs::FS& fs, const String& path, const String& sensorId) {
+	_fs = &fs;
+	_path = path;
+	_isReady = false;
+	_seq = 0;
+	memset(&_state, 0, sizeof(_state));
+
+	File file = fs.open(path.c_str(), FILE_READ);
+	if (file && readHeader(file, sensorId)) {
+		// Continue from the newest valid block, decoding it
+		// for the coder state.
+		Block block;
+		for (uint16_t slot = 0; slot < _blockCount; slot++) {
+			uint32_t seq;
+			if (file.seek(sizeof(Header) + slot * sizeof(Block))
+				&& file.read((uint8_t*)&seq, sizeof(seq)) == sizeof(seq)
+				&& seq > _seq && readBlock(file, seq, block)) {
+				_seq = seq;
+			}
+		}
+		if (_seq != 0 && readBlock(file, _seq, block)) {
+			decode(block, _state, [](const dataPoint&) {});
+		}
+		file.close();
+		_isReady = true;
+		return true;
+	}
+	if (file) {
+		file.close();
+	}
+	_isReady = create(sensorId);
+	return _isReady;
+}
+
+/// <summary>
+/// Reads and validates the header against this archive's layout.
+/// </summary>
+bool SeriesArchive::readHeader(File& file, const String& sensorId) {
+	Header header;
+	if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+		return false;
+	}
+	return header.magic == MAGIC
+		&& header.version == VERSION
+		&& header.blockSize == sizeof(Block)
+		&& header.blockCount == _blockCount
+		&& strncmp(header.sensorId, sensorId.c_str(), SENSOR_ID_SIZE - 1) == 0
+		&& header.crc == Utilities::crc32(&header, offsetof(Header, crc))
+		&& file.size() >= sizeof(Header) + _blockCount * sizeof(Block);
+}
+
+/// <summary>
+/// Reads the block with a sequence number. Returns false if
+/// its slot holds another block or the CRC fails.
+/// </summary>
+bool SeriesArchive::readBlock(File& file, uint32_t seq, Block& block) {
+	if (seq == 0
+		|| !file.seek(blockOffset(seq))
+		|| file.read((uint8_t*)&block, sizeof(block)) != sizeof(block)) {
+		return false;
+	}
+	return block.seq == seq
+		&& block.count > 0
+		&& block.bitCount <= BITS_CAPACITY
+		&& block.crc == Utilities::crc32(&block, offsetof(Block, crc));
+}
+
+/// <summary>
+/// Creates archive file with header and empty blocks.
+/// </summary>
+bool SeriesArchive::create(const String& sensorId) {
+	File file = _fs->open(_path.c_str(), FILE_WRITE);
+	if (!file) {
+		Serial.printf("ERROR: SeriesArchive could not create %s\n", _path.c_str());
+		return false;
+	}
+	Header header;
+	memset(&header, 0, sizeof(header));
+	header.magic = MAGIC;
+	header.version = VERSION;
+	header.blockSize = sizeof(Block);
+	header.blockCount = _blockCount;
+	strncpy(header.sensorId, sensorId.c_str(), SENSOR_ID_SIZE - 1);
+	header.crc = Utilities::crc32(&header, offsetof(Header, crc));
+	bool isOK = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+
+	// Reserve space for all blocks now, so appends never grow the file.
+	Block empty;
+	memset(&empty, 0, sizeof(empty));
+	for (uint16_t slot = 0; slot < _blockCount && isOK; slot++) {
+		isOK = file.write((const uint8_t*)&empty, sizeof(empty)) == sizeof(empty);
+	}
+	file.close();
+	if (!isOK) {
+		Serial.printf("ERROR: SeriesArchive could not write %s\n", _path.c_str());
+	}
+	return isOK;
+}
+
+/// <summary>
+/// Codes a point after the last in a block. The first point of
+/// a block is sent as is; later ones as the change in time step
+/// (see DOD_BUCKETS) and the XOR of the value bits with the last:
+///   0                             same value
+///   10 [bits]                     changed bits within the last window
+///   11 [leading:5] [length-1:5] [bits]   new window
+/// Leaves block and state unchanged if the point does not fit.
+/// </summary>
+/// <param name="block">Block to add to.</param>
+/// <param name="state">Coder state after the last point.</param>
+/// <param name="time">Time of point.</param>
+/// <param name="valueBits">Bits of float value.</param>
+/// <returns>False if the point does not fit in the block.</returns>
+bool SeriesArchive::encode(Block& block, CoderState& state, uint32_t time, uint32_t valueBits) {
+	Block coded = block;
+	CoderState next = state;
+	unsigned int bitCount = block.bitCount;
+	bool isOK = true;
+	if (block.count == 0) {
+		isOK = writeBits(coded, bitCount, time, RAW_BITS)
+			&& writeBits(coded, bitCount, valueBits, RAW_BITS);
+		next.delta = 0;
+		next.length = 0;
+		coded.firstTime = time;
+	}
+	else {
+		// Time.
+		int32_t delta = (int32_t)(time - state.time);
+		int32_t dod = delta - state.delta;
+		if (dod == 0) {
+			isOK = writeBits(coded, bitCount, 0, 1);
+		}
+		else {
+			for (const auto& bucket : DOD_BUCKETS) {
+				if (signExtend((uint32_t)dod, bucket.valueBits) == dod) {
+					isOK = writeBits(coded, bitCount, bucket.prefix, bucket.prefixBits)
+						&& writeBits(coded, bitCount, (uint32_t)dod, bucket.valueBits);
+					break;
+				}
+			}
+		}
+		next.delta = delta;
+
+		// Value.
+		uint32_t xorBits = valueBits ^ state.valueBits;
+		if (xorBits == 0) {
+			isOK = isOK && writeBits(coded, bitCount, 0, 1);
+		}
+		else {
+			unsigned int leading = std::min(31, __builtin_clz(xorBits));
+			unsigned int trailing = __builtin_ctz(xorBits);
+			if (state.length > 0 && leading >= state.leading
+				&& trailing >= RAW_BITS - state.leading - state.length) {
+				isOK = isOK && writeBits(coded, bitCount, 0b10, 2)
+					&& writeBits(coded, bitCount, xorBits >> (RAW_BITS - state.leading - state.length), state.length);
+			}
+			else {
+				unsigned int length = RAW_BITS - leading - trailing;
+				isOK = isOK && writeBits(coded, bitCount, 0b11, 2)
+					&& writeBits(coded, bitCount, leading, 5)
+					&& writeBits(coded, bitCount, length - 1, 5)
+					&& writeBits(coded, bitCount, xorBits >> trailing, length);
+				next.leading = leading;
+				next.length = length;
+			}
+		}
+	}
+	if (!isOK) {
+		return false;
+	}
+	next.time = time;
+	next.valueBits = valueBits;
+	coded.count++;
+	coded.bitCount = bitCount;
+	coded.lastTime = time;
+	block = coded;
+	state = next;
+	return true;
+}
+
+/// <summary>
+/// Decodes the points of a block (see encode()).
+/// </summary>
+/// <param name="block">Block to decode.</param>
+/// <param name="state">Set to the coder state after the last point.</param>
+/// <param name="onPoint">Called with each point, oldest first.</param>
+void SeriesArchive::decode(const Block& block, CoderState& state,
+	std::function<void(const dataPoint&)> onPoint)
+{
+	unsigned int bitIndex = 0;
+	for (uint16_t i = 0; i < block.count && bitIndex < block.bitCount; i++) {
+		if (i == 0) {
+			state.time = readBits(block, bitIndex, RAW_BITS);
+			state.valueBits = readBits(block, bitIndex, RAW_BITS);
+			state.delta = 0;
+			state.length = 0;
+		}
+		else {
+			// Time: count the 1s of the prefix to find the bucket.
+			unsigned int ones = 0;
+			while (ones < 5 && readBits(block, bitIndex, 1) == 1) {
+				ones++;
+			}
+			if (ones > 0) {
+				unsigned int numBits = DOD_BUCKETS[ones - 1].valueBits;
+				state.delta += signExtend(readBits(block, bitIndex, numBits), numBits);
+			}
+			state.time += state.delta;
+
+			// Value.
+			if (readBits(block, bitIndex, 1) == 1) {
+				if (readBits(block, bitIndex, 1) == 1) {
+					state.leading = readBits(block, bitIndex, 5);
+					state.length = readBits(block, bitIndex, 5) + 1;
+				}
+				uint32_t xorBits = readBits(block, bitIndex, state.length);
+				state.valueBits ^= xorBits << (RAW_BITS - state.leading - state.length);
+			}
+		}
+		onPoint(dataPoint(state.time, bitsToFloat(state.valueBits)));
+	}
+}
+
+/// <summary>
+/// Appends a point to the archive. Points should be in
+/// time order; an earlier time is kept, but costs more bits.
+/// </summary>
+/// <param name="dp">Data point to archive.</param>
+/// <returns>True on success.</returns>
+bool SeriesArchive::append(dataPoint dp) {
+	if (!_isReady) {
+		return false;
+	}
+	File file = _fs->open(_path.c_str(), "r+");
+	if (!file) {
+		Serial.printf("ERROR: SeriesArchive could not open %s\n", _path.c_str());
+		return false;
+	}
+	uint32_t valueBits = roundedBits(dp.value);
+	Block block;
+	CoderState state = _state;
+	if (!readBlock(file, _seq, block) || !encode(block, state, dp.time, valueBits)) {
+		// Start a new block, reusing the oldest slot.
+		memset(&block, 0, sizeof(block));
+		block.seq = _seq + 1;
+		encode(block, state, dp.time, valueBits);
+	}
+	block.crc = Utilities::crc32(&block, offsetof(Block, crc));
+
+	// Rewrite only the newest block, in place.
+	bool isOK = file.seek(blockOffset(block.seq))
+		&& file.write((const uint8_t*)&block, sizeof(block)) == sizeof(block);
+	file.close();
+	if (!isOK) {
+		Serial.printf("ERROR: SeriesArchive could not write %s\n", _path.c_str());
+		return false;
+	}
+	_seq = block.seq;
+	_state = state;
+	return true;
+}
+
+/// <summary>
+/// Calls a function with each archived point from a time
+/// to a time (inclusive), oldest first.
+/// </summary>
+/// <param name="timeFrom">Earliest time.</param>
+/// <param name="timeTo">Latest time.</param>
+/// <param name="onPoint">Called with each point.</param>
+/// <returns>Number of points found.</returns>
+unsigned int SeriesArchive::query(unsigned long timeFrom, unsigned long timeTo,
+	std::function<void(const dataPoint&)> onPoint)
+{
+	if (!_isReady || _seq == 0) {
+		return 0;
+	}
+	File file = _fs->open(_path.c_str(), FILE_READ);
+	if (!file) {
+		return 0;
+	}
+	unsigned int count = 0;
+	uint32_t seqFirst = (_seq > _blockCount) ? _seq - _blockCount + 1 : 1;
+	Block block;
+	CoderState state;
+	for (uint32_t seq = seqFirst; seq <= _seq; seq++) {
+		if (!readBlock(file, seq, block)
+			|| std::max(block.firstTime, block.lastTime) < timeFrom
+			|| std::min(block.firstTime, block.lastTime) > timeTo) {
+			continue;
+		}
+		decode(block, state, [&](const dataPoint& dp) {
+			if (dp.time >= timeFrom && dp.time <= timeTo) {
+				onPoint(dp);
+				count++;
+			}
+			});
+	}
+	file.close();
+	return count;
+}
+
+/// <summary>
+/// Clears a list and fills it with the archived points from a
+/// time to a time, reduced to at most the list's capacity: the
+/// range is split into equal spans, and each span with points
+/// gives one point. An average is at the time of the last point
+/// in the span, a maximum or minimum at the time of that point.
+/// </summary>
+/// <param name="timeFrom">Earliest time.</param>
+/// <param name="timeTo">Latest time.</param>
+/// <param name="targetList">List to fill.</param>
+/// <param name="reduce">Value kept for each span.</param>
+/// <returns>Number of points put in list.</returns>
+unsigned int SeriesArchive::query(unsigned long timeFrom, unsigned long timeTo,
+	RingBuffer<dataPoint>& targetList, periodValue reduce)
+{
+	targetList.clear();
+	if (timeTo < timeFrom || targetList.capacity() == 0) {
+		return 0;
+	}
+	unsigned long spanSec = (timeTo - timeFrom) / targetList.capacity() + 1;
+	unsigned long span = 0;		// Span of points summed.
+	dataPoint kept;				// Point kept for span.
+	float sum = 0;
+	unsigned int count = 0;
+	auto endSpan = [&]() {
+		if (count > 0) {
+			targetList.push_back((reduce == PERIOD_VALUE_AVERAGE) ? dataPoint(kept.time, sum / count) : kept);
+		}
+		sum = 0;
+		count = 0;
+	};
+	query(timeFrom, timeTo, [&](const dataPoint& dp) {
+		unsigned long spanOfPoint = (dp.time - timeFrom) / spanSec;
+		if (spanOfPoint != span) {
+			endSpan();
+			span = spanOfPoint;
+		}
+		bool isKept = (reduce == PERIOD_VALUE_MAX) ? dp.value > kept.value
+			: (reduce == PERIOD_VALUE_MIN) ? dp.value < kept.value
+			: true;		// Last point.
+		if (count == 0 || isKept) {
+			kept = dp;
+		}
+		sum += dp.value;
+		count++;
+		});
+	endSpan();
+	return targetList.size();
+}
+
+/// <summary>
+/// Returns the number of blocks written (at most blockCount).
+/// </summary>
+unsigned int SeriesArchive::blocksUsed() const {
+	return std::min((uint32_t)_blockCount, _seq);
+}
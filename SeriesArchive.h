@@ -0,0 +1,170 @@
+// SeriesArchive.h
+
+#ifndef _SERIESARCHIVE_h
+#define _SERIESARCHIVE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <algorithm>
+#include <functional>
+#include <FS.h>
+#include "App_Settings.h"
+#include "dataPoint.h"
+#include "RingBuffer.h"
+
+using namespace App_Settings;
+
+/// <summary>
+/// Long-term archive of a sensor data series, compressed in a
+/// fixed-size binary file.
+///
+/// The file holds a header followed by a fixed number of blocks,
+/// as SeriesStore, but each block packs as many points as fit in
+/// ARCHIVE_BLOCK_SIZE bytes, Gorilla style: times as the change in
+/// the time step (delta-of-delta), values as the XOR with the
+/// previous value. Values are first rounded to a resolution, which
+/// leaves the low mantissa bits zero. Each block starts afresh, so
+/// it can be decoded (or lost to a bad CRC) on its own. Appending
+/// rewrites only the newest block; when all are used, the oldest
+/// is reused. Only the coder state (not the block) is kept in RAM.
+/// </summary>
+class SeriesArchive {
+
+public:
+
+	static const uint32_t MAGIC = 0x41545357;		// "WSTA"
+	static const uint16_t VERSION = 1;
+	static const unsigned int SENSOR_ID_SIZE = 16;
+	static const unsigned int BLOCK_DATA_SIZE = ARCHIVE_BLOCK_SIZE - 20;
+
+	/// <summary>
+	/// File header.
+	/// </summary>
+	struct Header {
+		uint32_t magic;			// MAGIC.
+		uint16_t version;		// VERSION.
+		uint16_t blockSize;		// sizeof(Block).
+		uint16_t blockCount;	// Number of blocks in file.
+		uint16_t reserved;
+		char sensorId[SENSOR_ID_SIZE];	// Null-padded sensor file prefix.
+		uint32_t crc;			// CRC-32 of preceding fields.
+	};
+
+	/// <summary>
+	/// Block of compressed points.
+	/// </summary>
+	struct Block {
+		uint32_t seq;			// Sequence number; 0 if never written.
+		uint16_t count;			// Points in block.
+		uint16_t bitCount;		// Bits of data used.
+		uint32_t firstTime;		// Time of first point.
+		uint32_t lastTime;		// Time of last point.
+		uint8_t data[BLOCK_DATA_SIZE];	// Coded points, most significant bit first.
+		uint32_t crc;			// CRC-32 of preceding fields.
+	};
+
+	/// <summary>
+	/// State of the coder after a point, which codes the next.
+	/// </summary>
+	struct CoderState {
+		uint32_t time;			// Time of the point.
+		int32_t delta;			// Time since the point before.
+		uint32_t valueBits;		// Bits of the (rounded) float value.
+		uint8_t leading;		// Leading zeros of the last value window.
+		uint8_t length;			// Bits in the last value window; 0 if none.
+	};
+
+	/// <summary>
+	/// Creates an archive of a number of blocks.
+	/// </summary>
+	/// <param name="blockCount">Blocks in file (at least 2).</param>
+	/// <param name="resolution">Values are kept to within half of this.</param>
+	SeriesArchive(unsigned int blockCount, float resolution = SERIES_SCALE_DEFAULT);
+
+	/// <summary>
+	/// Opens the archive file, creating it if it is missing or
+	/// was written with a different layout or sensor id.
+	/// </summary>
+	/// <param name="fs">File system to use.</param>
+	/// <param name="path">Archive file path.</param>
+	/// <param name="sensorId">Sensor id saved in header.</param>
+	/// <returns>True if the archive is ready for use.</returns>
+	bool begin(fs::FS& fs, const String& path, const String& sensorId);
+
+	/// <summary>
+	/// Appends a point to the archive. Points should be in
+	/// time order; an earlier time is kept, but costs more bits.
+	/// </summary>
+	/// <param name="dp">Data point to archive.</param>
+	/// <returns>True on success.</returns>
+	bool append(dataPoint dp);
+
+	/// <summary>
+	/// Calls a function with each archived point from a time
+	/// to a time (inclusive), oldest first.
+	/// </summary>
+	/// <param name="timeFrom">Earliest time.</param>
+	/// <param name="timeTo">Latest time.</param>
+	/// <param name="onPoint">Called with each point.</param>
+	/// <returns>Number of points found.</returns>
+	unsigned int query(unsigned long timeFrom, unsigned long timeTo,
+		std::function<void(const dataPoint&)> onPoint);
+
+	/// <summary>
+	/// Clears a list and fills it with the archived points from a
+	/// time to a time, reduced to at most the list's capacity: the
+	/// range is split into equal spans, and each span with points
+	/// gives one point. An average is at the time of the last point
+	/// in the span, a maximum or minimum at the time of that point.
+	/// </summary>
+	/// <param name="timeFrom">Earliest time.</param>
+	/// <param name="timeTo">Latest time.</param>
+	/// <param name="targetList">List to fill.</param>
+	/// <param name="reduce">Value kept for each span.</param>
+	/// <returns>Number of points put in list.</returns>
+	unsigned int query(unsigned long timeFrom, unsigned long timeTo,
+		RingBuffer<dataPoint>& targetList, periodValue reduce = PERIOD_VALUE_AVERAGE);
+
+	/// <summary>
+	/// Sets the resolution of values appended from now on.
+	/// </summary>
+	/// <param name="resolution">Values are kept to within half of
+	/// this; 0 keeps them exactly.</param>
+	void setResolution(float resolution);
+
+	/// <summary>
+	/// Returns the number of blocks written (at most blockCount).
+	/// </summary>
+	unsigned int blocksUsed() const;
+
+	/// <summary>
+	/// Returns true after a successful begin().
+	/// </summary>
+	bool isReady() const { return _isReady; }
+
+private:
+
+	fs::FS* _fs = nullptr;		// File system of archive file.
+	String _path;				// Archive file path.
+	uint16_t _blockCount;		// Blocks in file.
+	int _resolutionExp;			// Values are kept to 2^_resolutionExp.
+	bool _isReady = false;
+	uint32_t _seq = 0;			// Sequence number of newest block.
+	CoderState _state;			// Coder state after newest point.
+
+	size_t blockOffset(uint32_t seq);
+	bool readHeader(File& file, const String& sensorId);
+	bool readBlock(File& file, uint32_t seq, Block& block);
+	bool create(const String& sensorId);
+	uint32_t roundedBits(float value);
+
+	static bool encode(Block& block, CoderState& state, uint32_t time, uint32_t valueBits);
+	static void decode(const Block& block, CoderState& state,
+		std::function<void(const dataPoint&)> onPoint);
+};
+
+#endif
@@ -0,0 +1,210 @@
+// 
+// 
+// 
+
+#include "SeriesStore.h"
+#include "Utilities.h"
+
+const uint32_t SeriesStore::MAGIC;
+const uint16_t SeriesStore::VERSION;
+const uint16_t SeriesStore::RECORDS_PER_BLOCK;
+const unsigned int SeriesStore::SENSOR_ID_SIZE;
+
+// File layout must not depend on compiler padding.
+static_assert(sizeof(SeriesStore::Header) == 32, "SeriesStore::Header layout");
+static_assert(sizeof(SeriesStore::Block) == 12 + 8 * SeriesStore::RECORDS_PER_BLOCK, "SeriesStore::Block layout");
+
+/// <summary>
+/// Creates a store that keeps at least the given number
+/// of most recent records.
+/// </summary>
+/// <param name="capacity">Records to keep.</param>
+SeriesStore::SeriesStore(unsigned int capacity) {
+	// One extra block so a full capacity remains while the newest fills.
+	_blockCount = (capacity + RECORDS_PER_BLOCK - 1) / RECORDS_PER_BLOCK + 1;
+	memset(&_block, 0, sizeof(_block));
+}
+
+/// <summary>
+/// Returns the file offset of the block slot used by a sequence number.
+/// </summary>
+size_t SeriesStore::blockOffset(uint32_t seq) {
+	return sizeof(Header) + (seq % _blockCount) * sizeof(Block);
+}
+
+/// <summary>
+/// Opens the store file, creating it if it is missing or
+/// was written with a different layout or sensor id.
+/// </summary>
+/// <param name="fs">File system to use.</param>
+/// <param name="path">Store file path.</param>
+/// <param name="sensorId">Sensor id saved in header.</param>
+/// <returns>True if the store is ready for use.</returns>
+bool SeriesStore::begin(fs::FS& fs, const String& path, const String& sensorId) {
+	_fs = &fs;
+	_path = path;
+	_isReady = false;
+	memset(&_block, 0, sizeof(_block));
+
+	File file = fs.open(path.c_str(), FILE_READ);
+	if (file && readHeader(file, sensorId)) {
+		// Continue from the newest valid block.
+		Block block;
+		for (uint16_t slot = 0; slot < _blockCount; slot++) {
+			if (readBlock(file, slot, block) && block.seq > _block.seq) {
+				_block = block;
+			}
+		}
+		file.close();
+		_isReady = true;
+		return true;
+	}
+	if (file) {
+		file.close();
+	}
+	_isReady = create(sensorId);
+	return _isReady;
+}
+
+/// <summary>
+/// Reads and validates the header against this store's layout.
+/// </summary>
+bool SeriesStore::readHeader(File& file, const String& sensorId) {
+	Header header;
+	if (file.read((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+		return false;
+	}
+	return header.magic == MAGIC
+		&& header.version == VERSION
+		&& header.recordSize == sizeof(Record)
+		&& header.recordsPerBlock == RECORDS_PER_BLOCK
+		&& header.blockCount == _blockCount
+		&& strncmp(header.sensorId, sensorId.c_str(), SENSOR_ID_SIZE - 1) == 0
+		&& header.crc == Utilities::crc32(&header, offsetof(Header, crc))
+		&& file.size() >= sizeof(Header) + _blockCount * sizeof(Block);
+}
+
+/// <summary>
+/// Reads a block slot. Returns false if never written or CRC fails.
+/// </summary>
+bool SeriesStore::readBlock(File& file, uint16_t slot, Block& block) {
+	if (!file.seek(sizeof(Header) + slot * sizeof(Block))
+		|| file.read((uint8_t*)&block, sizeof(block)) != sizeof(block)) {
+		return false;
+	}
+	return block.seq != 0
+		&& block.count <= RECORDS_PER_BLOCK
+		&& block.seq % _blockCount == slot
+		&& block.crc == Utilities::crc32(&block, offsetof(Block, crc));
+}
+
+/// <summary>
+/// Creates store file with header and empty blocks.
+/// </summary>
+bool SeriesStore::create(const String& sensorId) {
+	File file = _fs->open(_path.c_str(), FILE_WRITE);
+	if (!file) {
+		Serial.printf("ERROR: SeriesStore could not create %s\n", _path.c_str());
+		return false;
+	}
+	Header header;
+	memset(&header, 0, sizeof(header));
+	header.magic = MAGIC;
+	header.version = VERSION;
+	header.recordSize = sizeof(Record);
+	header.recordsPerBlock = RECORDS_PER_BLOCK;
+	header.blockCount = _blockCount;
+	strncpy(header.sensorId, sensorId.c_str(), SENSOR_ID_SIZE - 1);
+	header.crc = Utilities::crc32(&header, offsetof(Header, crc));
+	bool isOK = file.write((const uint8_t*)&header, sizeof(header)) == sizeof(header);
+
+	// Reserve space for all blocks now, so appends never grow the file.
+	Block empty;
+	memset(&empty, 0, sizeof(empty));
+	for (uint16_t slot = 0; slot < _blockCount && isOK; slot++) {
+		isOK = file.write((const uint8_t*)&empty, sizeof(empty)) == sizeof(empty);
+	}
+	file.close();
+	if (!isOK) {
+		Serial.printf("ERROR: SeriesStore could not write %s\n", _path.c_str());
+	}
+	return isOK;
+}
+
+/// <summary>
+/// Appends a (time, value) record to the store.
+/// </summary>
+/// <param name="dp">Data point to store.</param>
+/// <returns>True on success.</returns>
+bool SeriesStore::append(dataPoint dp) {
+	if (!_isReady) {
+		return false;
+	}
+	if (_block.seq == 0 || _block.count == RECORDS_PER_BLOCK) {
+		// Start a new block, reusing the oldest slot.
+		uint32_t seq = _block.seq + 1;
+		memset(&_block, 0, sizeof(_block));
+		_block.seq = seq;
+	}
+	_block.records[_block.count].epoch = dp.time;
+	_block.records[_block.count].value = dp.value;
+	_block.count++;
+	_block.crc = Utilities::crc32(&_block, offsetof(Block, crc));
+
+	// Rewrite only the newest block, in place.
+	File file = _fs->open(_path.c_str(), "r+");
+	if (!file) {
+		Serial.printf("ERROR: SeriesStore could not open %s\n", _path.c_str());
+		return false;
+	}
+	bool isOK = file.seek(blockOffset(_block.seq))
+		&& file.write((const uint8_t*)&_block, sizeof(_block)) == sizeof(_block);
+	file.close();
+	if (!isOK) {
+		Serial.printf("ERROR: SeriesStore could not write %s\n", _path.c_str());
+	}
+	return isOK;
+}
+
+/// <summary>
+/// Clears a list and fills it with stored records,
+/// oldest first.
+/// </summary>
+/// <param name="targetList">List to fill.</param>
+/// <returns>Number of records loaded.</returns>
+unsigned int SeriesStore::load(RingBuffer<dataPoint>& targetList) {
+	targetList.clear();
+	if (!_isReady || _block.seq == 0) {
+		return 0;
+	}
+	File file = _fs->open(_path.c_str(), FILE_READ);
+	if (!file) {
+		return 0;
+	}
+	// Blocks in file have sequence numbers up to the newest.
+	uint32_t seqFirst = (_block.seq > _blockCount) ? _block.seq - _blockCount + 1 : 1;
+	Block block;
+	for (uint32_t seq = seqFirst; seq <= _block.seq; seq++) {
+		if (readBlock(file, seq % _blockCount, block) && block.seq == seq) {
+			for (uint16_t i = 0; i < block.count; i++) {
+				targetList.push_back(dataPoint(block.records[i].epoch, block.records[i].value));
+			}
+		}
+	}
+	file.close();
+	return targetList.size();
+}
+
+/// <summary>
+/// Returns true if records have been stored.
+/// </summary>
+bool SeriesStore::hasData() {
+	return _isReady && _block.seq != 0;
+}
+
+/// <summary>
+/// Returns true after a successful begin().
+/// </summary>
+bool SeriesStore::isReady() {
+	return _isReady;
+}
@@ -0,0 +1,124 @@
+// SeriesStore.h
+
+#ifndef _SERIESSTORE_h
+#define _SERIESSTORE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <FS.h>
+#include "dataPoint.h"
+#include "RingBuffer.h"
+
+/// <summary>
+/// Stores a sensor data series in a fixed-size binary file.
+///
+/// The file holds a header followed by a fixed number of blocks,
+/// each with a sequence number, up to RECORDS_PER_BLOCK
+/// (epoch, value) records and a CRC. Appending a record rewrites
+/// only the newest block, in place. When all blocks are used, the
+/// oldest is reused, so the file never grows and older blocks are
+/// not rewritten. A block with a bad CRC (for example, from
+/// power loss mid-write) is skipped on load.
+/// </summary>
+class SeriesStore {
+
+public:
+
+	static const uint32_t MAGIC = 0x53545357;		// "WSTS"
+	static const uint16_t VERSION = 1;
+	static const uint16_t RECORDS_PER_BLOCK = 8;
+	static const unsigned int SENSOR_ID_SIZE = 16;
+
+	/// <summary>
+	/// A stored (time, value) record.
+	/// </summary>
+	struct Record {
+		uint32_t epoch;			// Time (seconds since Jan 1 1970).
+		float value;			// Data value.
+	};
+
+	/// <summary>
+	/// File header.
+	/// </summary>
+	struct Header {
+		uint32_t magic;			// MAGIC.
+		uint16_t version;		// VERSION.
+		uint16_t recordSize;	// sizeof(Record).
+		uint16_t recordsPerBlock;
+		uint16_t blockCount;	// Number of blocks in file.
+		char sensorId[SENSOR_ID_SIZE];	// Null-padded sensor file prefix.
+		uint32_t crc;			// CRC-32 of preceding fields.
+	};
+
+	/// <summary>
+	/// Block of records.
+	/// </summary>
+	struct Block {
+		uint32_t seq;			// Sequence number; 0 if never written.
+		uint16_t count;			// Records used.
+		uint16_t reserved;
+		Record records[RECORDS_PER_BLOCK];
+		uint32_t crc;			// CRC-32 of preceding fields.
+	};
+
+	/// <summary>
+	/// Creates a store that keeps at least the given number
+	/// of most recent records.
+	/// </summary>
+	/// <param name="capacity">Records to keep.</param>
+	SeriesStore(unsigned int capacity);
+
+	/// <summary>
+	/// Opens the store file, creating it if it is missing or
+	/// was written with a different layout or sensor id.
+	/// </summary>
+	/// <param name="fs">File system to use.</param>
+	/// <param name="path">Store file path.</param>
+	/// <param name="sensorId">Sensor id saved in header.</param>
+	/// <returns>True if the store is ready for use.</returns>
+	bool begin(fs::FS& fs, const String& path, const String& sensorId);
+
+	/// <summary>
+	/// Appends a (time, value) record to the store.
+	/// </summary>
+	/// <param name="dp">Data point to store.</param>
+	/// <returns>True on success.</returns>
+	bool append(dataPoint dp);
+
+	/// <summary>
+	/// Clears a list and fills it with stored records,
+	/// oldest first.
+	/// </summary>
+	/// <param name="targetList">List to fill.</param>
+	/// <returns>Number of records loaded.</returns>
+	unsigned int load(RingBuffer<dataPoint>& targetList);
+
+	/// <summary>
+	/// Returns true if records have been stored.
+	/// </summary>
+	bool hasData();
+
+	/// <summary>
+	/// Returns true after a successful begin().
+	/// </summary>
+	bool isReady();
+
+private:
+
+	fs::FS* _fs = nullptr;		// File system of store file.
+	String _path;				// Store file path.
+	uint16_t _blockCount;		// Blocks in file.
+	bool _isReady = false;
+	Block _block;				// Newest block (copy of file contents).
+
+	size_t blockOffset(uint32_t seq);
+	bool readHeader(File& file, const String& sensorId);
+	bool readBlock(File& file, uint16_t slot, Block& block);
+	bool create(const String& sensorId);
+};
+
+#endif
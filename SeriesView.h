@@ -0,0 +1,71 @@
+// SeriesView.h
+
+#ifndef _SERIESVIEW_h
+#define _SERIESVIEW_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "DataPoint.h"
+#include "RingBuffer.h"
+#include "CompactSeries.h"
+
+/// <summary>
+/// Read-only view of a list of dataPoints, either a RingBuffer or a
+/// CompactSeries, so functions that only read lists take either.
+/// Converts implicitly from both; points are given by value. The
+/// list must outlive the view.
+/// </summary>
+class SeriesView {
+
+	const RingBuffer<dataPoint>* _ring = nullptr;
+	const CompactSeries* _compact = nullptr;
+
+public:
+
+	/// <summary>
+	/// Forward iterator from oldest to newest point.
+	/// </summary>
+	class const_iterator {
+		const SeriesView* _view;
+		unsigned int _index;
+	public:
+		const_iterator(const SeriesView* view, unsigned int index) :
+			_view(view), _index(index) {}
+		dataPoint operator*() const { return (*_view)[_index]; }
+		CompactSeries::const_iterator::Arrow operator->() const { return { (*_view)[_index] }; }
+		const_iterator& operator++() { _index++; return *this; }
+		const_iterator operator++(int) { const_iterator it = *this; _index++; return it; }
+		bool operator==(const const_iterator& other) const { return _index == other._index; }
+		bool operator!=(const const_iterator& other) const { return _index != other._index; }
+	};
+
+	SeriesView() {}		// Empty list.
+	SeriesView(const RingBuffer<dataPoint>& list) : _ring(&list) {}
+	SeriesView(const CompactSeries& list) : _compact(&list) {}
+
+	/// <summary>
+	/// Returns point by age, where 0 is the oldest.
+	/// </summary>
+	/// <param name="index">Index from 0 to size() - 1.</param>
+	dataPoint operator[](unsigned int index) const {
+		return (_compact != nullptr) ? (*_compact)[index] : (*_ring)[index];
+	}
+
+	unsigned int size() const {
+		return (_compact != nullptr) ? _compact->size()
+			: (_ring != nullptr) ? _ring->size() : 0;
+	}
+
+	dataPoint front() const { return (*this)[0]; }			// Oldest point.
+	dataPoint back() const { return (*this)[size() - 1]; }	// Newest point.
+	bool empty() const { return size() == 0; }
+
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, size()); }
+};
+
+#endif
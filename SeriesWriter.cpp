@@ -0,0 +1,148 @@
+// 
+// 
+// 
+
+#include "SeriesWriter.h"
+
+/// <summary>
+/// Creates a writer for a single list of dataPoints.
+/// </summary>
+/// <param name="targetList">List of dataPoints.</param>
+/// <param name="isConvertZeroToEmpty">
+/// Set true to convert zero value to empty string.</param>
+/// <param name="decimalPlaces">Decimal places to display.</param>
+SeriesWriter::SeriesWriter(SeriesView targetList,
+	bool isConvertZeroToEmpty,
+	unsigned int decimalPlaces) {
+	_lists[0] = targetList;
+	_numLists = 1;
+	_isConvertZeroToEmpty = isConvertZeroToEmpty;
+	_decimalPlaces = decimalPlaces;
+}
+
+/// <summary>
+/// Creates a writer for two lists of dataPoints,
+/// delimited by "|".
+/// </summary>
+/// <param name="targetList_hi">First list of dataPoints.</param>
+/// <param name="targetList_lo">Second list of dataPoints.</param>
+/// <param name="isConvertZeroToEmpty">
+/// Set true to convert zero value to empty string.</param>
+/// <param name="decimalPlaces">Decimal places to display.</param>
+SeriesWriter::SeriesWriter(SeriesView targetList_hi,
+	SeriesView targetList_lo,
+	bool isConvertZeroToEmpty,
+	unsigned int decimalPlaces) {
+	_lists[0] = targetList_hi;
+	_lists[1] = targetList_lo;
+	_numLists = 2;
+	_isConvertZeroToEmpty = isConvertZeroToEmpty;
+	_decimalPlaces = decimalPlaces;
+}
+
+/// <summary>
+/// Restarts output from the beginning.
+/// </summary>
+void SeriesWriter::rewind() {
+	_listIndex = 0;
+	_elemIndex = 0;
+	_isListStarted = false;
+	_pendingLen = 0;
+	_pendingPos = 0;
+}
+
+/// <summary>
+/// Copies the lists into buffers and returns a writer of the
+/// copies, with the same options.
+/// </summary>
+/// <param name="list_hi">Buffer for first list.</param>
+/// <param name="list_lo">Buffer for second list, if any.</param>
+/// <returns>Writer of the copies, from the beginning.</returns>
+SeriesWriter SeriesWriter::copyTo(RingBuffer<dataPoint>& list_hi, RingBuffer<dataPoint>& list_lo) const {
+	RingBuffer<dataPoint>* copies[] = { &list_hi, &list_lo };
+	for (unsigned int i = 0; i < 2; i++) {
+		copies[i]->clear();
+		if (i < _numLists) {
+			for (dataPoint dp : _lists[i]) {
+				copies[i]->push_back(dp);
+			}
+		}
+	}
+	return (_numLists == 2)
+		? SeriesWriter(list_hi, list_lo, _isConvertZeroToEmpty, _decimalPlaces)
+		: SeriesWriter(list_hi, _isConvertZeroToEmpty, _decimalPlaces);
+}
+
+/// <summary>
+/// Queues the next piece of output text in _pending:
+/// an empty-list marker, a "|" between lists, or one
+/// "time,value" dataPoint (preceded by "~" if not first).
+/// </summary>
+/// <returns>False when there is no more output.</returns>
+bool SeriesWriter::nextPiece() {
+	_pendingLen = 0;
+	_pendingPos = 0;
+	while (_listIndex < _numLists) {
+		const SeriesView& targetList = _lists[_listIndex];
+		if (!_isListStarted) {
+			_isListStarted = true;
+			if (_listIndex > 0) {
+				_pending[_pendingLen++] = '|';	// delimiter between lists
+			}
+			if (targetList.size() == 0) {
+				// Same markers as listToString_data.
+				const char* marker = (_numLists == 1) ? "[-EMPTY-]"
+					: (_listIndex == 0) ? "[-EMPTY HI-]" : "[-EMPTY LO-]";
+				strcpy(_pending + _pendingLen, marker);
+				_pendingLen += strlen(marker);
+			}
+		}
+		if (_elemIndex < targetList.size()) {
+			dataPoint dp = targetList[_elemIndex];
+			if (_elemIndex > 0) {
+				_pending[_pendingLen++] = '~';
+			}
+			_pendingLen += snprintf(_pending + _pendingLen,
+				sizeof(_pending) - _pendingLen, "%lu,", dp.time);
+			if (!(_isConvertZeroToEmpty && dp.value == 0)) {
+				// Same conversion as String(float, decimalPlaces).
+				dtostrf(dp.value, _decimalPlaces + 2, _decimalPlaces, _pending + _pendingLen);
+				_pendingLen += strlen(_pending + _pendingLen);
+			}
+			_elemIndex++;
+			return true;
+		}
+		// This list is finished; move to next.
+		_listIndex++;
+		_elemIndex = 0;
+		_isListStarted = false;
+		if (_pendingLen > 0) {
+			return true;	// Marker for an empty list.
+		}
+	}
+	return false;
+}
+
+/// <summary>
+/// Copies the next part of the output into a buffer.
+/// The output is not null-terminated.
+/// </summary>
+/// <param name="buffer">Buffer to fill.</param>
+/// <param name="maxLen">Size of buffer.</param>
+/// <returns>Number of chars written, or 0 when done.</returns>
+size_t SeriesWriter::read(char* buffer, size_t maxLen) {
+	size_t written = 0;
+	while (written < maxLen) {
+		if (_pendingPos == _pendingLen && !nextPiece()) {
+			break;	// No more output.
+		}
+		size_t n = _pendingLen - _pendingPos;
+		if (n > maxLen - written) {
+			n = maxLen - written;
+		}
+		memcpy(buffer + written, _pending + _pendingPos, n);
+		_pendingPos += n;
+		written += n;
+	}
+	return written;
+}
@@ -0,0 +1,97 @@
+// SeriesWriter.h
+
+#ifndef _SERIESWRITER_h
+#define _SERIESWRITER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "dataPoint.h"
+#include "RingBuffer.h"
+#include "SeriesView.h"
+
+/// <summary>
+/// Writes one or two lists of dataPoints as delimited text, in
+/// pieces, into caller-supplied buffers. Output is the same as
+/// ListFunctions::listToString_data ("t1,v1~t2,~t3,v3", with two
+/// lists joined by "|"), but no String is built, so a web server
+/// can stream it straight into its response buffer.
+/// </summary>
+class SeriesWriter {
+
+	SeriesView _lists[2];			// Lists to write.
+	unsigned int _numLists;			// 1, or 2 for "hi|lo".
+	bool _isConvertZeroToEmpty;		// Write zero values as empty.
+	unsigned int _decimalPlaces;	// Decimal places for values.
+
+	unsigned int _listIndex = 0;	// List now being written.
+	unsigned int _elemIndex = 0;	// Next element of that list.
+	bool _isListStarted = false;	// True once list's first piece is queued.
+
+	char _pending[72];				// Text of current piece (one dataPoint or marker).
+	unsigned int _pendingLen = 0;	// Length of text in _pending.
+	unsigned int _pendingPos = 0;	// Next char of _pending to copy out.
+
+	/// <summary>
+	/// Queues the next piece of output text in _pending.
+	/// </summary>
+	/// <returns>False when there is no more output.</returns>
+	bool nextPiece();
+
+public:
+
+	/// <summary>
+	/// Creates a writer for a single list of dataPoints.
+	/// </summary>
+	/// <param name="targetList">List of dataPoints.</param>
+	/// <param name="isConvertZeroToEmpty">
+	/// Set true to convert zero value to empty string.</param>
+	/// <param name="decimalPlaces">Decimal places to display.</param>
+	SeriesWriter(SeriesView targetList,
+		bool isConvertZeroToEmpty,
+		unsigned int decimalPlaces);
+
+	/// <summary>
+	/// Creates a writer for two lists of dataPoints,
+	/// delimited by "|".
+	/// </summary>
+	/// <param name="targetList_hi">First list of dataPoints.</param>
+	/// <param name="targetList_lo">Second list of dataPoints.</param>
+	/// <param name="isConvertZeroToEmpty">
+	/// Set true to convert zero value to empty string.</param>
+	/// <param name="decimalPlaces">Decimal places to display.</param>
+	SeriesWriter(SeriesView targetList_hi,
+		SeriesView targetList_lo,
+		bool isConvertZeroToEmpty,
+		unsigned int decimalPlaces);
+
+	/// <summary>
+	/// Copies the next part of the output into a buffer.
+	/// The output is not null-terminated.
+	/// </summary>
+	/// <param name="buffer">Buffer to fill.</param>
+	/// <param name="maxLen">Size of buffer.</param>
+	/// <returns>Number of chars written, or 0 when done.</returns>
+	size_t read(char* buffer, size_t maxLen);
+
+	/// <summary>
+	/// Restarts output from the beginning.
+	/// </summary>
+	void rewind();
+
+	/// <summary>
+	/// Copies the lists into buffers and returns a writer of the
+	/// copies, with the same options, so output can be read after
+	/// the lists change. A list longer than its buffer keeps only
+	/// its newest points.
+	/// </summary>
+	/// <param name="list_hi">Buffer for first list.</param>
+	/// <param name="list_lo">Buffer for second list, if any.</param>
+	/// <returns>Writer of the copies, from the beginning.</returns>
+	SeriesWriter copyTo(RingBuffer<dataPoint>& list_hi, RingBuffer<dataPoint>& list_lo) const;
+};
+
+#endif
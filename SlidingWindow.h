@@ -0,0 +1,148 @@
+// SlidingWindow.h
+
+#ifndef _SLIDINGWINDOW_h
+#define _SLIDINGWINDOW_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+/// <summary>
+/// Sliding window over the most recent values, holding a running
+/// sum for the average and monotonic queues for the minimum and
+/// maximum. Adding a value and reading the average, minimum or
+/// maximum all take constant (amortized) time, whatever the
+/// window size. Storage is static, up to CAPACITY values.
+/// </summary>
+template <unsigned int CAPACITY>
+class SlidingWindow {
+
+	float _values[CAPACITY];			// Values, indexed by sequence % CAPACITY.
+	unsigned long _minQueue[CAPACITY];	// Sequence numbers of ascending values.
+	unsigned long _maxQueue[CAPACITY];	// Sequence numbers of descending values.
+	unsigned int _minHead = 0, _minCount = 0;
+	unsigned int _maxHead = 0, _maxCount = 0;
+
+	unsigned int _windowSize;			// Number of values in window.
+	unsigned int _count = 0;			// Number of values held (up to _windowSize).
+	unsigned long _seq = 0;				// Sequence number of next value added.
+	double _sum = 0;					// Running sum of values held.
+
+	float valueAt(unsigned long seq) const { return _values[seq % CAPACITY]; }
+
+	/// <summary>
+	/// Adds sequence number to back of a monotonic queue, first
+	/// removing expired entries from the front, then entries from
+	/// the back that can no longer be the window extreme. Expired
+	/// entries go first, so the queue has room when windowSize is
+	/// CAPACITY and no entry left refers to an overwritten value.
+	/// </summary>
+	void queueAdd(unsigned long* queue, unsigned int& head, unsigned int& count,
+		float val, bool isMax)
+	{
+		while (count > 0 && queue[head] + _windowSize <= _seq) {
+			head = (head + 1) % CAPACITY;
+			count--;
+		}
+		while (count > 0) {
+			float back = valueAt(queue[(head + count - 1) % CAPACITY]);
+			if (isMax ? (back > val) : (back < val)) {
+				break;
+			}
+			count--;
+		}
+		queue[(head + count) % CAPACITY] = _seq;
+		count++;
+	}
+
+public:
+
+	/// <summary>
+	/// Creates an empty sliding window.
+	/// </summary>
+	/// <param name="windowSize">Number of values in window
+	/// (1 to CAPACITY).</param>
+	SlidingWindow(unsigned int windowSize = CAPACITY) {
+		setWindowSize(windowSize);
+	}
+
+	/// <summary>
+	/// Sets the number of values in window and clears all values.
+	/// </summary>
+	/// <param name="windowSize">Number of values in window
+	/// (clamped to 1 to CAPACITY).</param>
+	void setWindowSize(unsigned int windowSize) {
+		if (windowSize < 1) {
+			windowSize = 1;
+		}
+		_windowSize = (windowSize > CAPACITY) ? CAPACITY : windowSize;
+		clear();
+	}
+
+	/// <summary>
+	/// Removes all values.
+	/// </summary>
+	void clear() {
+		_minHead = _minCount = 0;
+		_maxHead = _maxCount = 0;
+		_count = 0;
+		_seq = 0;
+		_sum = 0;
+	}
+
+	/// <summary>
+	/// Adds a value, removing the oldest if the window is full.
+	/// </summary>
+	/// <param name="val">Value to add.</param>
+	void add(float val) {
+		if (_count == _windowSize) {
+			_sum -= valueAt(_seq - _windowSize);	// Drop oldest.
+			_count--;
+		}
+		_values[_seq % CAPACITY] = val;
+		_count++;
+		queueAdd(_maxQueue, _maxHead, _maxCount, val, true);
+		queueAdd(_minQueue, _minHead, _minCount, val, false);
+		_seq++;
+		if (_seq % _windowSize == 0) {
+			// Re-sum once per window so rounding can't accumulate.
+			_sum = 0;
+			for (unsigned long s = _seq - _count; s < _seq; s++) {
+				_sum += valueAt(s);
+			}
+		}
+		else {
+			_sum += val;
+		}
+	}
+
+	/// <summary>
+	/// Returns average of values in window, or 0 if empty.
+	/// </summary>
+	float average() const { return (_count > 0) ? _sum / _count : 0; }
+
+	/// <summary>
+	/// Returns smallest value in window, or 0 if empty.
+	/// </summary>
+	float minimum() const { return (_count > 0) ? valueAt(_minQueue[_minHead]) : 0; }
+
+	/// <summary>
+	/// Returns largest value in window, or 0 if empty.
+	/// </summary>
+	float maximum() const { return (_count > 0) ? valueAt(_maxQueue[_maxHead]) : 0; }
+
+	/// <summary>
+	/// Returns most recently added value, or 0 if empty.
+	/// </summary>
+	float newest() const { return (_count > 0) ? valueAt(_seq - 1) : 0; }
+
+	float sum() const { return _sum; }
+	unsigned int size() const { return _count; }
+	unsigned int windowSize() const { return _windowSize; }
+	bool empty() const { return _count == 0; }
+	bool full() const { return _count == _windowSize; }
+};
+
+#endif
@@ -0,0 +1,87 @@
+// SpscQueue.h
+
+#ifndef _SPSCQUEUE_h
+#define _SPSCQUEUE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <atomic>
+
+/// <summary>
+/// Lock-free queue from one producer task to one consumer task,
+/// which may run on different cores. Neither side waits on the
+/// other: push() fails when the queue is full and pop() fails
+/// when it is empty. Only the producer writes _tail and only the
+/// consumer writes _head; each publishes with a release store,
+/// so an element is fully written before the other side sees it.
+/// CAPACITY must be a power of 2, so the free-running indexes
+/// stay correct when they wrap.
+/// </summary>
+template <typename T, unsigned int CAPACITY>
+class SpscQueue {
+
+	static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+		"SpscQueue CAPACITY must be a power of 2.");
+
+	T _data[CAPACITY];
+	std::atomic<unsigned int> _head{ 0 };	// Count of elements popped (consumer).
+	std::atomic<unsigned int> _tail{ 0 };	// Count of elements pushed (producer).
+	unsigned long _dropped = 0;				// Pushes refused when full (producer).
+
+public:
+
+	/// <summary>
+	/// Adds an element. Producer only.
+	/// </summary>
+	/// <param name="val">Element to add.</param>
+	/// <returns>False, and the element is dropped, if the queue is full.</returns>
+	bool push(const T& val) {
+		unsigned int tail = _tail.load(std::memory_order_relaxed);
+		if (tail - _head.load(std::memory_order_acquire) >= CAPACITY) {
+			_dropped++;
+			return false;
+		}
+		_data[tail % CAPACITY] = val;
+		_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// Removes the oldest element. Consumer only.
+	/// </summary>
+	/// <param name="val">Set to the element removed.</param>
+	/// <returns>False if the queue is empty.</returns>
+	bool pop(T& val) {
+		unsigned int head = _head.load(std::memory_order_relaxed);
+		if (head == _tail.load(std::memory_order_acquire)) {
+			return false;
+		}
+		val = _data[head % CAPACITY];
+		_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	/// <summary>
+	/// Returns the number of elements waiting (a snapshot, if
+	/// called while the other side is running).
+	/// </summary>
+	unsigned int size() const {
+		unsigned int head = _head.load(std::memory_order_acquire);	// Before _tail, so never past it.
+		return _tail.load(std::memory_order_acquire) - head;
+	}
+
+	bool empty() const { return size() == 0; }
+	unsigned int capacity() const { return CAPACITY; }
+
+	/// <summary>
+	/// Returns the number of pushes refused because the queue
+	/// was full (counted by the producer).
+	/// </summary>
+	unsigned long dropped() const { return _dropped; }
+};
+
+#endif
@@ -4,6 +4,7 @@
 
 #include "Testing.h"
 #include "ListFunctions.h"
+#include "Utilities.h"
 
 
 
@@ -67,7 +68,8 @@ void Testing::testCodeForSetup2(bool isInfiniteLoop) {
 	String s2 = "1,64~2,~3,63~4,~5,61";
 	Serial.println("String to convert to list:");
 	Serial.println(s2);
-	list<dataPoint> dpList2 = listData_fromString(s2);
+	FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST> dpList2;
+	listData_fromString(s2, dpList2);
 	Serial.println("String derived from list of data points:");
 	Serial.println(listToString_data(dpList2));
 
@@ -97,7 +99,9 @@ void Testing::testCodeForSetup3(bool isInfiniteLoop) {
 	listPrint(sList);
 
 	Serial.println("Convert using listData_fromString:");
-	listPrint(listData_fromString(s));
+	FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST> dpList;
+	listData_fromString(s, dpList);
+	listPrint(dpList);
 
 	Serial.println("TEST COMPLETE");
 	Serial.println(LINE_SEPARATOR);
@@ -566,3 +570,2195 @@ float Testing::addDummyRotations(list<float> srcList, WindSpeed& speedObj, float
 //	Serial.print(F("Raw = ")); Serial.print(windDir.angleAvg_now()); Serial.print(F(" ADU\t"));
 //	Serial.print(F("WindDirection = ")); Serial.print(windDir.heading()); Serial.println();
 //}
+
+/// <summary>
+/// Compares insert and iterate cost of the fixed-capacity 
+/// RingBuffer against std::list for a sensor data series.
+/// </summary>
+/// <param name="numInserts">Number of dataPoints to add.</param>
+void Testing::benchmarkRingBuffer(unsigned long numInserts) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.printf("BENCHMARK RingBuffer vs std::list, %lu inserts, %u elements\n",
+		numInserts, (unsigned int)SIZE_DAY_LIST);
+	unsigned long numPasses = numInserts / SIZE_DAY_LIST;
+	float listSum = 0, ringSum = 0;		// Keep the compiler from discarding loops.
+
+	// std::list: one node allocated and one freed per insert.
+	list<dataPoint> dpList;
+	unsigned long timeStart = micros();
+	for (unsigned long i = 0; i < numInserts; i++) {
+		dpList.push_back(dataPoint(i, i % 100));
+		if (dpList.size() > SIZE_DAY_LIST) {
+			dpList.pop_front();
+		}
+	}
+	unsigned long listInsert_us = micros() - timeStart;
+	timeStart = micros();
+	for (unsigned long pass = 0; pass < numPasses; pass++) {
+		for (list<dataPoint>::iterator it = dpList.begin(); it != dpList.end(); ++it) {
+			listSum += it->value;
+		}
+	}
+	unsigned long listIterate_us = micros() - timeStart;
+
+	// RingBuffer: fixed storage, no allocation.
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> dpRing;
+	timeStart = micros();
+	for (unsigned long i = 0; i < numInserts; i++) {
+		addToList(dpRing, dataPoint(i, i % 100), SIZE_DAY_LIST);
+	}
+	unsigned long ringInsert_us = micros() - timeStart;
+	timeStart = micros();
+	for (unsigned long pass = 0; pass < numPasses; pass++) {
+		for (RingBuffer<dataPoint>::const_iterator it = dpRing.begin(); it != dpRing.end(); ++it) {
+			ringSum += it->value;
+		}
+	}
+	unsigned long ringIterate_us = micros() - timeStart;
+
+	Serial.printf("std::list   insert %8lu us, iterate %8lu us\n", listInsert_us, listIterate_us);
+	Serial.printf("RingBuffer  insert %8lu us, iterate %8lu us\n", ringInsert_us, ringIterate_us);
+
+	// Both must hold the same newest elements.
+	bool isMatch = (dpList.size() == dpRing.size()) && (listSum == ringSum);
+	unsigned int i = 0;
+	for (list<dataPoint>::iterator it = dpList.begin(); isMatch && it != dpList.end(); ++it, i++) {
+		isMatch = (it->time == dpRing[i].time) && (it->value == dpRing[i].value);
+	}
+	if (!isMatch) {
+		Serial.println("ERROR: Testing::benchmarkRingBuffer. RingBuffer does not match std::list.");
+	}
+	Serial.println(LINE_SEPARATOR);
+}
+
+/// <summary>
+/// Checks SlidingWindow average, minimum and maximum against 
+/// brute-force results over a window of recent values, for 
+/// irregular, strictly rising and strictly falling values. 
+/// Monotonic values fill a monotonic queue, which irregular 
+/// ones never do.
+/// </summary>
+/// <param name="windowSize">Number of values in window.</param>
+/// <param name="numValues">Number of values to add.</param>
+/// <returns>Number of mismatches.</returns>
+unsigned int Testing::testSlidingWindow(unsigned int windowSize, unsigned long numValues) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.printf("TEST SlidingWindow, window %u, %lu values\n", windowSize, numValues);
+	SlidingWindow<SIZE_RAW_LIST> window(windowSize);
+	FixedRingBuffer<float, SIZE_RAW_LIST> recent;
+	unsigned long errors = 0;
+	for (unsigned int shape = 0; shape < 3; shape++) {
+		window.clear();
+		recent.clear();
+		for (unsigned long i = 0; i < numValues; i++) {
+			float val = (shape == 0) ? (long)((i * 37) % 101) - 50 + 0.25f	// Irregular, with negatives.
+				: (shape == 1) ? i * 0.5f - 100		// Rising.
+				: 100 - i * 0.5f;					// Falling.
+			window.add(val);
+			addToList(recent, val, window.windowSize());
+			float minVal = recent[0], maxVal = recent[0];
+			for (unsigned int j = 1; j < recent.size(); j++) {
+				minVal = (recent[j] < minVal) ? recent[j] : minVal;
+				maxVal = (recent[j] > maxVal) ? recent[j] : maxVal;
+			}
+			if (fabs(window.average() - listAverage(recent, recent.size())) > 0.01
+				|| window.minimum() != minVal || window.maximum() != maxVal) {
+				errors++;
+			}
+		}
+	}
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testSlidingWindow. %lu mismatches.\n", errors);
+	}
+	else {
+		Serial.println("SlidingWindow matches brute force.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks that SeriesWriter output is byte-identical to 
+/// listToString_data, when read in chunks of various sizes.
+/// </summary>
+/// <returns>Number of mismatches.</returns>
+unsigned int Testing::testSeriesWriter() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST SeriesWriter vs listToString_data");
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> empty, hi, lo;
+	float values[] = { 0, 5, -3.25, 12.5, 0.004, 99.995, -0.4, 1013.2, 123456.7, 0 };
+	for (unsigned int i = 0; i < SIZE_DAY_LIST + 5; i++) {
+		addToList(hi, dataPoint(1700000000UL + i * 600, values[i % 10]), SIZE_DAY_LIST);
+		addToList(lo, dataPoint(1700000000UL + i * 600, -values[(i + 3) % 10]), SIZE_DAY_LIST);
+	}
+	size_t chunkSizes[] = { 1, 7, 64, 1460 };
+	unsigned int errors = 0;
+	for (unsigned int places = 0; places < 3; places++) {
+		for (int zero = 0; zero < 2; zero++) {
+			String expected[] = {
+				listToString_data(hi, zero, places),
+				listToString_data(empty, zero, places),
+				listToString_data(hi, lo, zero, places),
+				listToString_data(empty, lo, zero, places),
+				listToString_data(hi, empty, zero, places)
+			};
+			SeriesWriter writers[] = {
+				SeriesWriter(hi, zero, places),
+				SeriesWriter(empty, zero, places),
+				SeriesWriter(hi, lo, zero, places),
+				SeriesWriter(empty, lo, zero, places),
+				SeriesWriter(hi, empty, zero, places)
+			};
+			for (unsigned int w = 0; w < 5; w++) {
+				for (size_t chunk : chunkSizes) {
+					String actual;
+					char buffer[1460 + 1];
+					size_t n;
+					writers[w].rewind();
+					while ((n = writers[w].read(buffer, chunk)) > 0) {
+						buffer[n] = '\0';
+						actual += buffer;
+					}
+					if (actual != expected[w]) {
+						errors++;
+						Serial.printf("ERROR: Testing::testSeriesWriter. Case %u, %u places, chunk %u:\n%s\n%s\n",
+							w, places, (unsigned int)chunk, expected[w].c_str(), actual.c_str());
+					}
+				}
+			}
+		}
+	}
+
+	// A writer of copies keeps its output when the lists change.
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> copy_hi, copy_lo;
+	String expected = listToString_data(hi, lo, true, 1);
+	SeriesWriter copied = SeriesWriter(hi, lo, true, 1).copyTo(copy_hi, copy_lo);
+	hi.clear();
+	lo.push_back(dataPoint(1800000000UL, 1));
+	String actual;
+	char buffer[64 + 1];
+	size_t n;
+	while ((n = copied.read(buffer, 64)) > 0) {
+		buffer[n] = '\0';
+		actual += buffer;
+	}
+	if (actual != expected) {
+		errors++;
+		Serial.printf("ERROR: Testing::testSeriesWriter. Copy:\n%s\n%s\n",
+			expected.c_str(), actual.c_str());
+	}
+	if (errors == 0) {
+		Serial.println("SeriesWriter output is byte-identical.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks SeriesStore round trip, wrap-around, reopen and 
+/// skipping of a corrupted block.
+/// </summary>
+/// <param name="fs">File system for the test file.</param>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testSeriesStore(fs::FS& fs) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST SeriesStore");
+	const char* path = "/seriesStoreTest.bin";
+	unsigned int errors = 0;
+	fs.remove(path);
+
+	SeriesStore store(SIZE_10_MIN_LIST);
+	FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST> expected, loaded;
+	errors += !store.begin(fs, path, "test");
+	errors += store.hasData();
+	// Enough records to wrap around the file more than once.
+	for (unsigned int i = 1; i <= 3 * SIZE_10_MIN_LIST + 5; i++) {
+		dataPoint dp(1700000000UL + i * 600, i * 0.5f);
+		errors += !store.append(dp);
+		expected.push_back(dp);
+	}
+	store.load(loaded);
+	errors += (listToString_data(loaded) != listToString_data(expected));
+
+	// Reopen, as after reboot, and continue appending.
+	SeriesStore reopened(SIZE_10_MIN_LIST);
+	errors += !reopened.begin(fs, path, "test");
+	reopened.append(dataPoint(1800000000UL, 42));
+	expected.push_back(dataPoint(1800000000UL, 42));
+	reopened.load(loaded);
+	errors += (listToString_data(loaded) != listToString_data(expected));
+
+	// A different sensor id recreates an empty file.
+	SeriesStore other(SIZE_10_MIN_LIST);
+	errors += !other.begin(fs, path, "other");
+	errors += other.hasData();
+	errors += (other.load(loaded) != 0);
+
+	// Corrupt one byte of a full block; only that block is lost.
+	for (unsigned int i = 1; i <= 2 * SeriesStore::RECORDS_PER_BLOCK; i++) {
+		other.append(dataPoint(i, i));
+	}
+	File file = fs.open(path, "r+");
+	file.seek(sizeof(SeriesStore::Header) + 1 * sizeof(SeriesStore::Block) + 10);
+	file.write((uint8_t)0xFF);
+	file.close();
+	SeriesStore corrupted(SIZE_10_MIN_LIST);
+	corrupted.begin(fs, path, "other");
+	errors += (corrupted.load(loaded) != SeriesStore::RECORDS_PER_BLOCK);
+	errors += (loaded.size() > 0 && loaded[0].time != SeriesStore::RECORDS_PER_BLOCK + 1);
+
+	fs.remove(path);
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testSeriesStore. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("SeriesStore checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Compares reading a data file one byte at a time (the old 
+/// fileRead loop) with the block-read functions.
+/// </summary>
+/// <param name="fs">File system for the test file.</param>
+/// <param name="fileSize">Size of test file, bytes.</param>
+/// <param name="repeats">Number of times to read the file.</param>
+void Testing::benchmarkFileRead(fs::FS& fs, size_t fileSize, unsigned int repeats) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.printf("BENCHMARK fileRead, %u bytes x %u\n", (unsigned int)fileSize, repeats);
+	const char* path = "/fileReadTest.txt";
+	std::string contents;
+	for (unsigned long t = 1700000000UL; contents.size() < fileSize; t += 600) {
+		contents += std::to_string(t) + ",12.3~";
+	}
+	contents.resize(fileSize);
+	fileWrite(fs, path, contents.c_str());
+
+	// Byte loop, as fileRead was (but bounded).
+	char* bytes = new char[fileSize + 1];
+	unsigned long timeStart = micros();
+	for (unsigned int r = 0; r < repeats; r++) {
+		File file = fs.open(path, FILE_READ);
+		size_t i = 0;
+		while (file.available() && i < fileSize) {
+			bytes[i++] = file.read();
+		}
+		bytes[i] = '\0';
+		file.close();
+	}
+	unsigned long byteLoop_us = micros() - timeStart;
+	bool isMatch = contents == bytes;
+	delete[] bytes;
+
+	String s;
+	timeStart = micros();
+	for (unsigned int r = 0; r < repeats; r++) {
+		s = fileRead(fs, path);
+	}
+	unsigned long string_us = micros() - timeStart;
+	isMatch = isMatch && contents == s.c_str();
+
+	std::string stdString;
+	timeStart = micros();
+	for (unsigned int r = 0; r < repeats; r++) {
+		fileReadInto(fs, path, stdString);
+	}
+	unsigned long stdString_us = micros() - timeStart;
+	isMatch = isMatch && contents == stdString;
+
+	unsigned long checksum = 0;
+	timeStart = micros();
+	for (unsigned int r = 0; r < repeats; r++) {
+		fileReadBlocks(fs, path, [&checksum](const char* block, size_t length) {
+			for (size_t i = 0; i < length; i++) {
+				checksum += (uint8_t)block[i];
+			}
+			return true;
+		});
+	}
+	unsigned long blocks_us = micros() - timeStart;
+
+	Serial.printf("byte loop            %8lu us\n", byteLoop_us);
+	Serial.printf("fileRead (String)    %8lu us\n", string_us);
+	Serial.printf("fileReadInto (std)   %8lu us\n", stdString_us);
+	Serial.printf("fileReadBlocks       %8lu us\n", blocks_us);
+	if (!isMatch) {
+		Serial.println("ERROR: Testing::benchmarkFileRead. Contents do not match.");
+	}
+	fs.remove(path);
+	Serial.println(LINE_SEPARATOR);
+}
+
+/// <summary>
+/// Checks LogBuffer wrap-around, partial peek/consume, and 
+/// dropping of whole writes when the buffer is full.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testLogBuffer() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST LogBuffer");
+	unsigned int errors = 0;
+	LogBuffer log(16);
+	char out[32];
+	size_t n;
+
+	errors += !log.empty();
+	errors += !log.write("0123456789", 10);
+	errors += (log.size() != 10);
+	// Partial read, as when a flush block is smaller than the text.
+	n = log.peek(out, 4);
+	errors += (n != 4 || memcmp(out, "0123", 4) != 0);
+	log.consume(4);
+
+	// This write wraps around the end of the buffer.
+	errors += !log.write("abcdefghij", 10);
+	n = log.peek(out, sizeof(out));
+	errors += (n != 16 || memcmp(out, "456789abcdefghij", 16) != 0);
+
+	// A write that does not fit is dropped whole and counted.
+	errors += log.write("X", 1);
+	errors += (log.takeDroppedBytes() != 1);
+	errors += (log.takeDroppedBytes() != 0);
+	log.consume(n);
+	errors += !log.empty();
+	errors += (log.ageMillis() != 0);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testLogBuffer. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("LogBuffer checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks SensorRegistry lookups by chart and short name, 
+/// chart series, and that each period processes only the 
+/// sensors with its role.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testSensorRegistry() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST SensorRegistry");
+	typedef SensorRegistry R;
+	unsigned int errors = 0;
+	SensorRegistry registry;
+	SensorData temp(false), pres(false), wind(false);
+	registry.add(temp, "Temperature", "temp", "F", "&deg;F", CHART_TEMPERATURE_F, R::ROLE_ALL);
+	registry.add(pres, "Pressure (abs)", "presAbs", "mb", "", CHART_NONE, R::ROLE_10_MIN);
+	registry.add(wind, "Wind direction", "windDir", "", "&deg;", CHART_WIND_DIRECTION,
+		R::ROLE_ALL & ~R::ROLE_CHART_MAX_MIN);
+
+	errors += (registry.size() != 3);
+	errors += (registry.find(CHART_TEMPERATURE_F) == nullptr
+		|| registry.find(CHART_TEMPERATURE_F)->sensor != &temp);
+	errors += (registry.find("presAbs") == nullptr || registry.find("presAbs")->sensor != &pres);
+	errors += (registry.find(CHART_NONE) != nullptr);
+	errors += (registry.find(CHART_UV_INDEX) != nullptr);
+	errors += (registry.find("none") != nullptr);
+	errors += (temp.units_html() != "&deg;F" || pres.units() != "mb");
+	errors += !registry.find(CHART_TEMPERATURE_F)->hasSeries(SERIES_DAY_MAX_MIN);
+	errors += registry.find(CHART_WIND_DIRECTION)->hasSeries(SERIES_DAY_MAX_MIN);
+	errors += !registry.find(CHART_WIND_DIRECTION)->hasSeries(SERIES_DAY_MIN);
+	errors += registry.find("presAbs")->hasSeries(SERIES_10_MIN);
+
+	temp.addReading(dataPoint(1000, 60));
+	pres.addReading(dataPoint(1000, 990));
+	registry.process(PERIOD_10_MIN);
+	registry.process(PERIOD_60_MIN);
+	errors += (temp.data_10_min().size() != 1 || pres.data_10_min().size() != 1);
+	errors += (temp.data_60_min().size() != 1 || pres.data_60_min().size() != 0);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testSensorRegistry. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("SensorRegistry checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+namespace {
+
+	/// <summary>
+	/// Registered sensors with a snapshot of their readings, which
+	/// the placeholder processors of benchmarkPlaceholders() both
+	/// read. GPS is not on the host, so its values are fixed.
+	/// </summary>
+	struct BenchStation {
+		SensorData temp{ false }, windSpeed{ false }, windGust{ false },
+			presSeaLvl{ false }, presAbs{ false }, insol{ false }, rh{ false },
+			uvA{ false }, uvB{ false }, uvIndex{ false }, irSky{ false }, fanRPM{ false };
+		WindDirection windDir;
+		SensorRegistry registry;
+		ReadingsSnapshot snapshot;
+		chartRequested chart = CHART_TEMPERATURE_F;
+		bool isGood_UV = true;
+		float latitude = 45.523064f, longitude = -122.676483f, altitude = 61.2f;
+
+		BenchStation() {
+			typedef SensorRegistry R;
+			registry.add(windSpeed, "Wind Speed", "wind", "mph", "", CHART_WIND_SPEED, R::ROLE_ALL);
+			registry.add(windGust, "Wind Gust", "gust", "mph", "", CHART_WIND_GUST, R::ROLE_ALL);
+			registry.add(windDir, "Wind direction", "windDir", "", "&deg;", CHART_WIND_DIRECTION, R::ROLE_ALL);
+			registry.add(temp, "Temperature", "temp", "F", "&deg;F", CHART_TEMPERATURE_F, R::ROLE_ALL);
+			registry.add(presAbs, "Pressure (abs)", "presAbs", "mb", "", CHART_NONE, R::ROLE_10_MIN);
+			registry.add(presSeaLvl, "Pressure (SL)", "presSeaLvl", "mb", "", CHART_PRESSURE_SEA_LEVEL, R::ROLE_ALL);
+			registry.add(rh, "Rel. Humidity", "RH", "%", "&percnt;", CHART_RELATIVE_HUMIDITY, R::ROLE_ALL);
+			registry.add(uvA, "UV A Radiation", "uvA", "", "", CHART_NONE, R::ROLE_10_MIN);
+			registry.add(uvB, "UV B Radiation", "uvB", "", "", CHART_NONE, R::ROLE_10_MIN);
+			registry.add(uvIndex, "UV Index", "uvIndex", "", "", CHART_UV_INDEX, R::ROLE_ALL);
+			registry.add(insol, "Insolation", "sun", "%", "&percnt;", CHART_INSOLATION, R::ROLE_ALL);
+			registry.add(irSky, "Sky Temperature", "skyTemp", "C", "&degC;", CHART_IR_SKY, R::ROLE_ALL);
+			registry.add(fanRPM, "Aspirator Fan speed", "fanSpeed", "rpm", "", CHART_NONE, R::ROLE_NONE);
+			SensorData* sensors[] = { &temp, &windSpeed, &windGust, &presSeaLvl, &presAbs,
+				&insol, &rh, &uvA, &uvB, &uvIndex, &irSky, &fanRPM };
+			for (unsigned int i = 0; i < 10; i++) {
+				unsigned long time = 1700000000UL + i * BASE_PERIOD_SEC;
+				for (unsigned int s = 0; s < sizeof(sensors) / sizeof(sensors[0]); s++) {
+					sensors[s]->addReading(dataPoint(time, 10 * s + i * 0.7f));
+				}
+				windDir.addReading(time, 200 + i, 5);
+			}
+			snapshot.take(registry, windDir, 1700000000UL + 10 * BASE_PERIOD_SEC);
+		}
+
+		const ReadingsSnapshot::Values& values(const SensorData& sensor) const {
+			return snapshot.of(registry, sensor);
+		}
+	};
+
+	/// <summary>
+	/// The processor() of the baseline release: a chain of
+	/// String compares, in its order, reading the snapshot.
+	/// </summary>
+	String baselineProcessor(const String& var, BenchStation& st) {
+	if (var == "CSS_LIGHT_STYLE") {
+		return "";
+	}
+	if (var == "LAST_READINGS_DATETIME") {
+		return String("06/01/2024 12:00:00");
+	}
+	if (var == "CURRENT_TIME") {
+		return String("12:00:00");
+	}
+	if (var == "WEEKDAY") {
+		return String("Saturday");
+	}
+	if (var == "TEMPERATURE_F") {
+		return String(st.values(st.temp).avg_now, 0);
+	}
+	if (var == "WIND_SPEED") {
+		return String(st.values(st.windSpeed).avg_now, 0);
+	}
+	if (var == "WIND_GUST") {
+		return String(st.values(st.windGust).max_10_min, 0);
+	}
+	if (var == "WIND_DIRECTION") {
+		return st.windDir.directionCardinal(st.snapshot.windAngle_10_min);
+	}
+	if (var == "WIND_ANGLE") {
+		return String(st.snapshot.windAngle_now, 0);
+	}
+	if (var == "GPS_ALTITUDE") {
+		return String(st.altitude, 0);
+	}
+	if (var == "PRESSURE_MB_SL") {
+		return String(st.values(st.presSeaLvl).avg_now, 0);
+	}
+	if (var == "PRESSURE_MB_ABS") {
+		return String(st.values(st.presAbs).avg_now, 0);
+	}
+	if (var == "WATER_BOILING_POINT") {
+		return String(Utilities::waterBoilingPoint_F(st.values(st.presAbs).avg_now), 0);
+	}
+	if (var == "INSOLATION_PERCENT") {
+		return String(st.values(st.insol).avg_now, 0);
+	}
+	if (var == "REL_HUMIDITY") {
+		return String(st.values(st.rh).avg_now, 0);
+	}
+	if (var == "UV_A") {
+		if (st.isGood_UV) {
+			return String(st.values(st.uvA).avg_now, 0);
+		}
+		else {
+			return String("na");
+		}
+	}
+	if (var == "UV_B") {
+		if (st.isGood_UV) {
+			return String(st.values(st.uvB).avg_now, 0);
+		}
+		else {
+			return String("na");
+		}
+	}
+	if (var == "UV_INDEX") {
+		return String(st.values(st.uvIndex).avg_now, 1);
+	}
+	if (var == "IR_T_SKY") {
+		return String(st.values(st.irSky).avg_now, 0);
+	}
+	if (var == "TEMPERATURE_F_HI") {
+		return String(st.values(st.temp).max_today, 0);
+	}
+	if (var == "WIND_SPEED_HI") {
+		return String(st.values(st.windSpeed).max_today, 0);
+	}
+	if (var == "WIND_GUST_HI") {
+		return String(st.values(st.windGust).max_today, 0);
+	}
+	if (var == "WIND_ANGLE_HI") {
+		return "??";
+	}
+	if (var == "PRESSURE_MB_SL_HI") {
+		return String(st.values(st.presSeaLvl).max_today, 0);
+	}
+	if (var == "INSOLATION_PERCENT_HI") {
+		return String(st.values(st.insol).max_today, 0);
+	}
+	if (var == "REL_HUMIDITY_HI") {
+		return String(st.values(st.rh).max_today, 0);
+	}
+	if (var == "UV_A_HI") {
+		if (st.isGood_UV) {
+			return String(st.values(st.uvA).max_today, 0);
+		}
+		else {
+			return String("na");
+		}
+	}
+	if (var == "UV_B_HI") {
+		if (st.isGood_UV) {
+			return String(st.values(st.uvB).max_today, 0);
+		}
+		else {
+			return String("na");
+		}
+	}
+	if (var == "UV_INDEX_HI") {
+		if (st.isGood_UV) {
+			return String(st.values(st.uvIndex).max_today, 1);
+		}
+		else {
+			return String("na");
+		}
+	}
+	if (var == "IR_T_SKY_HI") {
+		return String(st.values(st.irSky).max_today, 0);
+	}
+	if (var == "TEMPERATURE_F_LO") {
+		return String(st.values(st.temp).min_today, 0);
+	}
+	if (var == "WIND_SPEED_LO") {
+		return String(st.values(st.windSpeed).min_today, 0);
+	}
+	if (var == "WIND_GUST_LO") {
+		return String(st.values(st.windGust).min_today, 0);
+	}
+	if (var == "PRESSURE_MB_SL_LO") {
+		return String(st.values(st.presSeaLvl).min_today, 0);
+	}
+	if (var == "REL_HUMIDITY_LO") {
+		return String(st.values(st.rh).min_today, 0);
+	}
+	if (var == "IR_T_SKY_LO") {
+		return String(st.values(st.irSky).min_today, 0);
+	}
+	if (var == "GPS_IS_SYNCED") {
+		return String("Synced");
+	}
+	if (var == "GPS_LOCATIONS_UPDATE_COUNTER") {
+		return String(12);
+	}
+	if (var == "GPS_LATITUDE") {
+		return String(st.latitude, 6);
+	}
+	if (var == "GPS_LONGITUDE") {
+		return String(st.longitude, 6);
+	}
+	if (var == "GPS_ALTITUDE") { // Unreachable, as in the baseline.
+		return String(st.altitude);
+	}
+	if (var == "GPS_DATE") {
+		return String("06/01/2024");
+	}
+	if (var == "GPS_TIME") {
+		return String("19:00:00");
+	}
+	if (var == "GPS_DAYLIGHT_TIME_USED") {
+		return Utilities::bool_Yes_No(IS_DAYLIGHT_TIME);
+	}
+	if (var == "GPS_HDOP") {
+		return String(95 / 100.);
+	}
+	if (var == "GPS_SATELLITES") {
+		return String(8);
+	}
+	if (var == "ELAPSED_TIME_STRING") {
+		return String(41.5f, 2);
+	}
+	if (var == "FAN_RPM") {
+		return String(st.values(st.fanRPM).last);
+	}
+	if (var == "UTC_CURRENT_OFFSET_HOURS") {
+		if (IS_DAYLIGHT_TIME) {
+			return String(UTC_OFFSET_HOURS + 1);
+		}
+		else {
+			return String(UTC_OFFSET_HOURS);
+		}
+	}
+	if (var == "CHART_Y_AXIS_LABEL") {
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return "Chart not specified!";
+		case CHART_TEMPERATURE_F:
+			return String(st.temp.label() + ", " + st.temp.units_html());
+		case CHART_PRESSURE_SEA_LEVEL:
+			return String(st.presSeaLvl.label() + ", " + st.presSeaLvl.units());
+		case CHART_RELATIVE_HUMIDITY:
+			return String(st.rh.label() + ", " + st.rh.units_html());
+		default:
+			return "Chart not found";
+		}
+	}
+	if (var == "CHART_TITLE") {
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return "Chart not specified!";
+		case CHART_TEMPERATURE_F:
+			return String(st.temp.label());
+		case CHART_PRESSURE_SEA_LEVEL:
+			return String(st.presSeaLvl.label());
+		case CHART_RELATIVE_HUMIDITY:
+			return String(st.rh.label());
+		default:
+			return "Chart not found";
+		}
+	}
+	if (var == "Y_MIN") {
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return "min: -500";
+		case CHART_TEMPERATURE_F:
+			return "min: 0";
+		case CHART_PRESSURE_SEA_LEVEL:
+			return "min: 950";
+		case CHART_RELATIVE_HUMIDITY:
+			return "min: 0";
+		default:
+			return "min: -2000";
+		}
+	}
+	if (var == "Y_MAX") {
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return ", max: 500";
+		case CHART_TEMPERATURE_F:
+			return ", max: 100";
+		case CHART_PRESSURE_SEA_LEVEL:
+			return ", max: 1050";
+		case CHART_RELATIVE_HUMIDITY:
+			return ", max: 100";
+		default:
+			return ", max: 2000";
+		}
+	}
+	if (var == "Y_TICK_AMOUNT") {
+		switch (st.chart)
+		{
+		case CHART_TEMPERATURE_F:
+			return ", tickAmount: 5";
+		case CHART_PRESSURE_SEA_LEVEL:
+			return ", tickAmount: 3";
+		default:
+			return "";
+		}
+	}
+	return var + String(" not found");
+	}
+
+	/// <summary>
+	/// The same placeholders found by Placeholders::find(),
+	/// switching on the id, as processPlaceholder() does.
+	/// </summary>
+	String tableProcessor(const String& var, BenchStation& st) {
+	switch (Placeholders::find(var.c_str()))
+	{
+	case Placeholders::PH_CSS_LIGHT_STYLE:
+		return "";
+	case Placeholders::PH_LAST_READINGS_DATETIME:
+		return String("06/01/2024 12:00:00");
+	case Placeholders::PH_CURRENT_TIME:
+		return String("12:00:00");
+	case Placeholders::PH_WEEKDAY:
+		return String("Saturday");
+	case Placeholders::PH_TEMPERATURE_F:
+		return String(st.values(st.temp).avg_now, 0);
+	case Placeholders::PH_WIND_SPEED:
+		return String(st.values(st.windSpeed).avg_now, 0);
+	case Placeholders::PH_WIND_GUST:
+		return String(st.values(st.windGust).max_10_min, 0);
+	case Placeholders::PH_WIND_DIRECTION:
+		return st.windDir.directionCardinal(st.snapshot.windAngle_10_min);
+	case Placeholders::PH_WIND_ANGLE:
+		return String(st.snapshot.windAngle_now, 0);
+	case Placeholders::PH_GPS_ALTITUDE:
+		return String(st.altitude, 0);
+	case Placeholders::PH_PRESSURE_MB_SL:
+		return String(st.values(st.presSeaLvl).avg_now, 0);
+	case Placeholders::PH_PRESSURE_MB_ABS:
+		return String(st.values(st.presAbs).avg_now, 0);
+	case Placeholders::PH_WATER_BOILING_POINT:
+		return String(Utilities::waterBoilingPoint_F(st.values(st.presAbs).avg_now), 0);
+	case Placeholders::PH_INSOLATION_PERCENT:
+		return String(st.values(st.insol).avg_now, 0);
+	case Placeholders::PH_REL_HUMIDITY:
+		return String(st.values(st.rh).avg_now, 0);
+	case Placeholders::PH_UV_A:
+		if (st.isGood_UV) {
+			return String(st.values(st.uvA).avg_now, 0);
+		}
+		else {
+			return String("na");
+		}
+	case Placeholders::PH_UV_B:
+		if (st.isGood_UV) {
+			return String(st.values(st.uvB).avg_now, 0);
+		}
+		else {
+			return String("na");
+		}
+	case Placeholders::PH_UV_INDEX:
+		return String(st.values(st.uvIndex).avg_now, 1);
+	case Placeholders::PH_IR_T_SKY:
+		return String(st.values(st.irSky).avg_now, 0);
+	case Placeholders::PH_TEMPERATURE_F_HI:
+		return String(st.values(st.temp).max_today, 0);
+	case Placeholders::PH_WIND_SPEED_HI:
+		return String(st.values(st.windSpeed).max_today, 0);
+	case Placeholders::PH_WIND_GUST_HI:
+		return String(st.values(st.windGust).max_today, 0);
+	case Placeholders::PH_WIND_ANGLE_HI:
+		return "??";
+	case Placeholders::PH_PRESSURE_MB_SL_HI:
+		return String(st.values(st.presSeaLvl).max_today, 0);
+	case Placeholders::PH_INSOLATION_PERCENT_HI:
+		return String(st.values(st.insol).max_today, 0);
+	case Placeholders::PH_REL_HUMIDITY_HI:
+		return String(st.values(st.rh).max_today, 0);
+	case Placeholders::PH_UV_A_HI:
+		if (st.isGood_UV) {
+			return String(st.values(st.uvA).max_today, 0);
+		}
+		else {
+			return String("na");
+		}
+	case Placeholders::PH_UV_B_HI:
+		if (st.isGood_UV) {
+			return String(st.values(st.uvB).max_today, 0);
+		}
+		else {
+			return String("na");
+		}
+	case Placeholders::PH_UV_INDEX_HI:
+		if (st.isGood_UV) {
+			return String(st.values(st.uvIndex).max_today, 1);
+		}
+		else {
+			return String("na");
+		}
+	case Placeholders::PH_IR_T_SKY_HI:
+		return String(st.values(st.irSky).max_today, 0);
+	case Placeholders::PH_TEMPERATURE_F_LO:
+		return String(st.values(st.temp).min_today, 0);
+	case Placeholders::PH_WIND_SPEED_LO:
+		return String(st.values(st.windSpeed).min_today, 0);
+	case Placeholders::PH_WIND_GUST_LO:
+		return String(st.values(st.windGust).min_today, 0);
+	case Placeholders::PH_PRESSURE_MB_SL_LO:
+		return String(st.values(st.presSeaLvl).min_today, 0);
+	case Placeholders::PH_REL_HUMIDITY_LO:
+		return String(st.values(st.rh).min_today, 0);
+	case Placeholders::PH_IR_T_SKY_LO:
+		return String(st.values(st.irSky).min_today, 0);
+	case Placeholders::PH_GPS_IS_SYNCED:
+		return String("Synced");
+	case Placeholders::PH_GPS_LOCATIONS_UPDATE_COUNTER:
+		return String(12);
+	case Placeholders::PH_GPS_LATITUDE:
+		return String(st.latitude, 6);
+	case Placeholders::PH_GPS_LONGITUDE:
+		return String(st.longitude, 6);
+	case Placeholders::PH_GPS_DATE:
+		return String("06/01/2024");
+	case Placeholders::PH_GPS_TIME:
+		return String("19:00:00");
+	case Placeholders::PH_GPS_DAYLIGHT_TIME_USED:
+		return Utilities::bool_Yes_No(IS_DAYLIGHT_TIME);
+	case Placeholders::PH_GPS_HDOP:
+		return String(95 / 100.);
+	case Placeholders::PH_GPS_SATELLITES:
+		return String(8);
+	case Placeholders::PH_ELAPSED_TIME_STRING:
+		return String(41.5f, 2);
+	case Placeholders::PH_FAN_RPM:
+		return String(st.values(st.fanRPM).last);
+	case Placeholders::PH_UTC_CURRENT_OFFSET_HOURS:
+		if (IS_DAYLIGHT_TIME) {
+			return String(UTC_OFFSET_HOURS + 1);
+		}
+		else {
+			return String(UTC_OFFSET_HOURS);
+		}
+	case Placeholders::PH_CHART_Y_AXIS_LABEL:
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return "Chart not specified!";
+		case CHART_TEMPERATURE_F:
+			return String(st.temp.label() + ", " + st.temp.units_html());
+		case CHART_PRESSURE_SEA_LEVEL:
+			return String(st.presSeaLvl.label() + ", " + st.presSeaLvl.units());
+		case CHART_RELATIVE_HUMIDITY:
+			return String(st.rh.label() + ", " + st.rh.units_html());
+		default:
+			return "Chart not found";
+		}
+	case Placeholders::PH_CHART_TITLE:
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return "Chart not specified!";
+		case CHART_TEMPERATURE_F:
+			return String(st.temp.label());
+		case CHART_PRESSURE_SEA_LEVEL:
+			return String(st.presSeaLvl.label());
+		case CHART_RELATIVE_HUMIDITY:
+			return String(st.rh.label());
+		default:
+			return "Chart not found";
+		}
+	case Placeholders::PH_Y_MIN:
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return "min: -500";
+		case CHART_TEMPERATURE_F:
+			return "min: 0";
+		case CHART_PRESSURE_SEA_LEVEL:
+			return "min: 950";
+		case CHART_RELATIVE_HUMIDITY:
+			return "min: 0";
+		default:
+			return "min: -2000";
+		}
+	case Placeholders::PH_Y_MAX:
+		switch (st.chart)
+		{
+		case CHART_NONE:
+			return ", max: 500";
+		case CHART_TEMPERATURE_F:
+			return ", max: 100";
+		case CHART_PRESSURE_SEA_LEVEL:
+			return ", max: 1050";
+		case CHART_RELATIVE_HUMIDITY:
+			return ", max: 100";
+		default:
+			return ", max: 2000";
+		}
+	case Placeholders::PH_Y_TICK_AMOUNT:
+		switch (st.chart)
+		{
+		case CHART_TEMPERATURE_F:
+			return ", tickAmount: 5";
+		case CHART_PRESSURE_SEA_LEVEL:
+			return ", tickAmount: 3";
+		default:
+			return "";
+		}
+	default:
+		return var + String(" not found");
+	}
+	}
+}
+
+/// <summary>
+/// Renders a page with the baseline processor() chain of
+/// String compares and with Placeholders::find() and a switch,
+/// both from the same snapshot, and checks both give the same
+/// page. Times are for comparing the two on one machine.
+/// </summary>
+/// <param name="page">Page text, such as summary.html.</param>
+/// <param name="repeats">Times to render the page.</param>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::benchmarkPlaceholders(const String& page, unsigned int repeats) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.printf("BENCHMARK placeholders, %u bytes x %u\n", page.length(), repeats);
+	BenchStation* station = new BenchStation();
+	BenchStation& st = *station;
+	auto baseline = [&st](const String& var) { return baselineProcessor(var, st); };
+	auto table = [&st](const String& var) { return tableProcessor(var, st); };
+
+	String baselinePage, tablePage;
+	unsigned long timeStart = micros();
+	for (unsigned int r = 0; r < repeats; r++) {
+		baselinePage = PageCache::render(page, baseline);
+	}
+	unsigned long baseline_us = micros() - timeStart;
+
+	timeStart = micros();
+	for (unsigned int r = 0; r < repeats; r++) {
+		tablePage = PageCache::render(page, table);
+	}
+	unsigned long table_us = micros() - timeStart;
+	unsigned int errors = (baselinePage != tablePage || baselinePage.indexOf(" not found") >= 0);
+	delete station;
+
+	Serial.printf("render, baseline if-chain  %8lu us\n", baseline_us);
+	Serial.printf("render, sorted table       %8lu us\n", table_us);
+	if (errors > 0) {
+		Serial.println("ERROR: Testing::benchmarkPlaceholders. Pages differ.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks that every placeholder name round trips through
+/// Placeholders::find() and name(), and that every placeholder
+/// in a page is found, with the same id as a plain search of
+/// the names gives.
+/// </summary>
+/// <param name="page">Page text, such as summary.html.</param>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testPlaceholders(const String& page) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST Placeholders");
+	unsigned int errors = 0;
+	const unsigned int count = Placeholders::count();
+
+	for (unsigned int i = 1; i <= count; i++) {
+		Placeholders::placeholderId id = (Placeholders::placeholderId)i;
+		errors += (Placeholders::find(Placeholders::name(id)) != id);
+	}
+	errors += (Placeholders::find("NOT_A_PLACEHOLDER") != Placeholders::PH_NONE);
+	errors += (Placeholders::find("") != Placeholders::PH_NONE);
+
+	// Each placeholder of the page, by both lookups.
+	unsigned int numFound = 0, numMissing = 0;
+	auto search = [count](const String& var) {
+		for (unsigned int i = 1; i <= count; i++) {
+			if (var == Placeholders::name((Placeholders::placeholderId)i)) {
+				return String(i);
+			}
+		}
+		return var + String(" not found");
+	};
+	auto table = [&numFound, &numMissing](const String& var) {
+		Placeholders::placeholderId id = Placeholders::find(var.c_str());
+		if (id == Placeholders::PH_NONE) {
+			numMissing++;
+			Serial.printf("ERROR: Testing::testPlaceholders. %s not found.\n", var.c_str());
+			return var + String(" not found");
+		}
+		numFound++;
+		return String((unsigned int)id);
+	};
+	errors += (PageCache::render(page, search) != PageCache::render(page, table));
+	errors += numMissing;
+	errors += (numFound == 0);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testPlaceholders. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.printf("Placeholders checks passed (%u names, %u in page).\n", count, numFound);
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks PageCache template rendering, re-rendering only 
+/// after a new epoch, and ETags that follow page content.
+/// </summary>
+/// <param name="fs">File system for a temporary page.</param>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testPageCache(fs::FS& fs) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST PageCache");
+	unsigned int errors = 0;
+	const char* path = "/pageCacheTest.html";
+	fileWrite(fs, path, "<p>%TEMP% F, 100%% sure</p>");
+	int value = 60;
+	unsigned int calls = 0;
+	auto processor = [&value, &calls](const String& var) {
+		calls++;
+		return (var == "TEMP") ? String(value) : String("?");
+	};
+
+	PageCache cache(fs);
+	const PageCache::Page* page = cache.get(path, processor);
+	errors += (page == nullptr);
+	if (page != nullptr) {
+		errors += (page->body != "<p>60 F, 100% sure</p>");
+		String etag = page->etag;
+
+		// Same epoch: served from RAM, even though the value changed.
+		value = 61;
+		page = cache.get(path, processor);
+		errors += (cache.renders() != 1 || cache.hits() != 1);
+		errors += (page->etag != etag || page->body.indexOf("60 F") < 0);
+
+		// New epoch: rendered again, with a new ETag.
+		cache.invalidate();
+		page = cache.get(path, processor);
+		errors += (cache.renders() != 2 || page->body.indexOf("61 F") < 0);
+		errors += (page->etag == etag);
+
+		// New epoch with the same values: same ETag, so browsers get 304.
+		etag = page->etag;
+		cache.invalidate();
+		page = cache.get(path, processor);
+		errors += (cache.renders() != 3 || page->etag != etag);
+	}
+	errors += (calls != 3);
+
+	// A "%" without a closing "%", or too far from it, is left as it is.
+	String text = "5% off";
+	errors += (PageCache::render(text, processor) != text);
+	text = "%NOT_A_PLACEHOLDER_AS_IT_IS_TOO_LONG%";
+	errors += (PageCache::render(text, processor) != text);
+	errors += (calls != 3);
+	errors += (cache.get("/noSuchPage.html", processor) != nullptr);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testPageCache. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("PageCache checks passed.");
+	}
+	fs.remove(path);
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Times the operations of the per-tick sensor pipeline, with 
+/// readings from SensorSimulate waveforms, and prints ns/op. 
+/// An operation that needs set-up each time (such as a reading 
+/// before process_data_10_min) is timed with and without it, 
+/// and the difference reported.
+/// </summary>
+/// <param name="results">Array for the results, or nullptr.</param>
+/// <param name="maxResults">Size of results.</param>
+/// <param name="iterations">Times each operation is run.</param>
+/// <returns>Number of results.</returns>
+unsigned int Testing::benchmarkPipeline(BenchmarkResult* results, unsigned int maxResults, unsigned long iterations) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.printf("BENCHMARK pipeline, %lu iterations\n", iterations);
+	const unsigned int NUM_READINGS = 256;
+	unsigned int count = 0;
+	volatile float sink = 0;		// Keep the compiler from discarding loops.
+	auto report = [&](const char* name, unsigned long elapsed_us) {
+		float nsPerOp = 1000.0f * elapsed_us / iterations;
+		Serial.printf("%-32s %10.1f ns/op\n", name, nsPerOp);
+		if (results != nullptr && count < maxResults) {
+			results[count] = BenchmarkResult{ name, nsPerOp };
+		}
+		count++;
+	};
+
+	// Readings, made once so waveform cost is not timed.
+	SensorSimulate temperature, angle;
+	float readings[NUM_READINGS];
+	float angles[NUM_READINGS];
+	for (unsigned int i = 0; i < NUM_READINGS; i++) {
+		readings[i] = temperature.sawtooth(40, 0.5, 90, 20, 100, 3);
+		angles[i] = angle.sawtooth(0, 7, 359);
+	}
+
+	// SensorData::addReading.
+	SensorData sensor(false);
+	unsigned long timeStart = micros();
+	for (unsigned long i = 0; i < iterations; i++) {
+		sensor.addReading(dataPoint(i * 4, readings[i % NUM_READINGS]));
+	}
+	unsigned long addReading_us = micros() - timeStart;
+	report("SensorData::addReading", addReading_us);
+
+	// SensorData::process_data_10_min, after one reading each.
+	SensorData sensor10(false);
+	timeStart = micros();
+	for (unsigned long i = 0; i < iterations; i++) {
+		sensor10.addReading(dataPoint(i * 600, readings[i % NUM_READINGS]));
+		sensor10.process_data_10_min();
+	}
+	unsigned long process_us = micros() - timeStart;
+	report("SensorData::process_data_10_min", process_us > addReading_us ? process_us - addReading_us : 0);
+
+	// List to and from the text sent to charts and kept in files.
+	const CompactSeries& list10 = sensor10.data_10_min();
+	String text;
+	timeStart = micros();
+	for (unsigned long i = 0; i < iterations; i++) {
+		text = listToString_data(list10);
+	}
+	report("listToString_data", micros() - timeStart);
+
+	FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST> parsed;
+	timeStart = micros();
+	for (unsigned long i = 0; i < iterations; i++) {
+		listData_fromString(text, parsed);
+	}
+	report("listData_fromString", micros() - timeStart);
+	if (parsed.size() != list10.size()) {
+		Serial.println("ERROR: Testing::benchmarkPipeline. Parsed list does not match.");
+	}
+
+	// WindDirection::angleAvg_ofList, over an hour of 10-min angles.
+	WindDirection direction;
+	FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST> angleList;
+	for (unsigned int i = 0; i < SIZE_10_MIN_LIST; i++) {
+		angleList.push_back(dataPoint(i * 600, angles[i]));
+	}
+	timeStart = micros();
+	for (unsigned long i = 0; i < iterations; i++) {
+		sink = sink + direction.angleAvg_ofList(angleList, 6);
+	}
+	report("WindDirection::angleAvg_ofList", micros() - timeStart);
+
+	Serial.println(LINE_SEPARATOR);
+	return (count < maxResults) ? count : maxResults;
+}
+
+/// <summary>
+/// Replays days of simulated 4-s ticks from midnight, and checks 
+/// the number of 10-min, 60-min and day periods processed, and 
+/// that the data lists fill to (and wrap at) their sizes.
+/// </summary>
+/// <param name="days">Days to replay.</param>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testReplay(unsigned int days) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.printf("TEST Replay, %u days\n", days);
+	unsigned int errors = 0;
+	SimulatedStation station;
+	Replay replay(station.sensors,
+		[&station](TickSample& sample) { station.read(sample); },
+		[&station](const TickSample& sample) { station.apply(sample); });
+	const unsigned long START_TIME = 1704067200UL;	// 2024-01-01 00:00:00.
+	Replay::Stats stats = replay.run(START_TIME, (unsigned long)days * BASE_PERIODS_IN_24_HR);
+
+	errors += (stats.ticks != (unsigned long)days * BASE_PERIODS_IN_24_HR);
+	errors += (stats.periods_10_min != days * 144UL);
+	errors += (stats.periods_60_min != days * 24UL);
+	errors += (stats.days != days);		// Last tick is midnight.
+	unsigned int size_10_min = std::min(days * 144U, (unsigned int)SIZE_10_MIN_LIST);
+	unsigned int size_60_min = std::min(days * 24U, (unsigned int)SIZE_60_MIN_LIST);
+	unsigned int size_day = std::min(days, (unsigned int)SIZE_DAY_LIST);
+	errors += (station.temp_F.data_10_min().size() != size_10_min);
+	errors += (station.temp_F.data_60_min().size() != size_60_min);
+	errors += (station.temp_F.data_day_maxima().size() != size_day);
+	errors += (station.temp_F.data_day_minima().size() != size_day);
+	errors += (station.pres_mb.data_60_min().size() != 0);	// 10-min role only.
+	if (days > 0) {
+		errors += (station.temp_F.data_day_maxima().back().time > START_TIME + days * 86400UL);
+	}
+
+	Serial.printf("%lu ticks, %lu 10-min, %lu 60-min, %lu days in %lu ms (%.0f ticks/s)\n",
+		stats.ticks, stats.periods_10_min, stats.periods_60_min, stats.days,
+		stats.elapsed_us / 1000, stats.ticksPerSecond());
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testReplay. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("Replay checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks PhaseHistogram bucket bounds, percentiles and maximum,
+/// and that PhaseTimer reports only phases with durations.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testPhaseTimer() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST PhaseTimer");
+	unsigned int errors = 0;
+
+	// Bucket i holds 2^(i-1) to 2^i - 1 us.
+	errors += (PhaseHistogram::bucketIndex(0) != 0);
+	errors += (PhaseHistogram::bucketIndex(1) != 1);
+	errors += (PhaseHistogram::bucketIndex(3) != 2);
+	errors += (PhaseHistogram::bucketIndex(4) != 3);
+	errors += (PhaseHistogram::bucketIndex(1023) != 10);
+	errors += (PhaseHistogram::bucketIndex(1024) != 11);
+	errors += (PhaseHistogram::bucketIndex(0xFFFFFFFF) != PhaseHistogram::NUM_BUCKETS - 1);
+
+	// 90 fast and 10 slow durations.
+	PhaseHistogram h;
+	errors += (h.percentile(50) != 0);
+	for (unsigned int i = 0; i < 90; i++) {
+		h.add(100);
+	}
+	for (unsigned int i = 0; i < 10; i++) {
+		h.add(5000);
+	}
+	errors += (h.count() != 100);
+	errors += (h.max() != 5000);
+	errors += (h.total() != 90 * 100 + 10 * 5000);
+	errors += (h.bucket(PhaseHistogram::bucketIndex(100)) != 90);
+	errors += (h.percentile(50) != 127);		// Upper bound of 64-127 us bucket.
+	errors += (h.percentile(90) != 127);
+	errors += (h.percentile(95) != 5000);		// Bucket bound 8191, limited to max.
+	errors += (h.percentile(100) != 5000);
+
+	PhaseTimer timer;
+	timer.record(PHASE_WIND, 250);
+	timer.stop(PHASE_10_MIN, PhaseTimer::start());
+	timer.record(PHASE_COUNT, 1);				// Ignored.
+	errors += (timer.histogram(PHASE_WIND).count() != 1);
+	errors += (timer.histogram(PHASE_10_MIN).count() != 1);
+	errors += (timer.histogram(PHASE_FAN).count() != 0);
+	String report = timer.report();
+	Serial.print(report);
+	errors += (report.indexOf("wind") < 0);
+	errors += (report.indexOf("10_min") < 0);
+	errors += (report.indexOf("fan") >= 0);
+	timer.clear();
+	errors += (timer.histogram(PHASE_WIND).count() != 0);
+	errors += (timer.report().indexOf("wind") >= 0);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testPhaseTimer. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("PhaseTimer checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+namespace {
+	unsigned int _scheduledReads[4];	// Reads by each testSensorScheduler sensor.
+}
+
+/// <summary>
+/// Schedules four sensors as the sketch does (three slow ones
+/// on different phases, one every tick), runs a 10-min period,
+/// and checks read counts, phases, the most reads on one tick,
+/// and that invalid entries are refused.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testSensorScheduler() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST SensorScheduler");
+	unsigned int errors = 0;
+	memset(_scheduledReads, 0, sizeof(_scheduledReads));
+	SensorScheduler schedule;
+	errors += !schedule.add("slow0", [](TickSample&) { _scheduledReads[0]++; }, SENSOR_READ_PERIOD, 0);
+	errors += !schedule.add("slow1", [](TickSample&) { _scheduledReads[1]++; }, SENSOR_READ_PERIOD, 1);
+	errors += !schedule.add("slow3", [](TickSample&) { _scheduledReads[2]++; }, SENSOR_READ_PERIOD, 3, PHASE_IR_MLX90614);
+	errors += !schedule.add("fast", [](TickSample&) { _scheduledReads[3]++; }, 1, 0);
+	// Refused: phase not less than period, zero period, no function.
+	errors += schedule.add("bad", [](TickSample&) {}, SENSOR_READ_PERIOD, SENSOR_READ_PERIOD);
+	errors += schedule.add("bad", [](TickSample&) {}, 0, 0);
+	errors += schedule.add("bad", nullptr, 1, 0);
+	errors += (schedule.count() != 4);
+
+	// Tick 0 reads slow0 and fast; tick 1 slow1 and fast; tick 2 fast only.
+	errors += (schedule.countDue(0) != 2);
+	errors += (schedule.countDue(2) != 1);
+	errors += (schedule.countDue(SENSOR_READ_PERIOD + 3) != 2);
+	errors += (schedule.maxDue() != 2);
+
+	PhaseTimer timer;
+	unsigned int numRead = 0;
+	for (unsigned int i = 0; i < BASE_PERIODS_IN_10_MIN; i++) {
+		TickSample sample;
+		unsigned int numReadTick = schedule.tick(sample, &timer);
+		errors += (numReadTick > 2);
+		numRead += numReadTick;
+	}
+	const unsigned int READS_SLOW = BASE_PERIODS_IN_10_MIN / SENSOR_READ_PERIOD;
+	errors += (schedule.ticks() != BASE_PERIODS_IN_10_MIN);
+	errors += (_scheduledReads[0] != READS_SLOW);
+	errors += (_scheduledReads[1] != READS_SLOW);
+	errors += (_scheduledReads[2] != READS_SLOW);
+	errors += (_scheduledReads[3] != BASE_PERIODS_IN_10_MIN);
+	errors += (numRead != 3 * READS_SLOW + BASE_PERIODS_IN_10_MIN);
+	errors += (timer.histogram(PHASE_IR_MLX90614).count() != READS_SLOW);	// Only timed entry.
+	errors += (timer.histogram(PHASE_COUNT).count() != 0);
+
+	Serial.printf("%u reads in %u ticks, at most %u per tick (%u if read every tick)\n",
+		numRead, (unsigned int)BASE_PERIODS_IN_10_MIN, schedule.maxDue(), schedule.count());
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testSensorScheduler. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("SensorScheduler checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks SpscQueue order, full and empty, and wrap-around, and
+/// that TickSample refuses readings past MAX_READINGS.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testSpscQueue() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST SpscQueue");
+	unsigned int errors = 0;
+	SpscQueue<unsigned int, 4> queue;
+	unsigned int val = 0;
+	errors += queue.pop(val);				// Empty.
+	errors += !queue.empty();
+	for (unsigned int i = 0; i < 4; i++) {
+		errors += !queue.push(i);
+	}
+	errors += queue.push(99);				// Full: dropped.
+	errors += (queue.dropped() != 1);
+	errors += (queue.size() != 4);
+	// Pop and push past the end of storage many times; order is kept.
+	unsigned int next = 0;
+	for (unsigned int i = 4; i < 1000; i++) {
+		errors += !queue.pop(val);
+		errors += (val != next++);
+		errors += !queue.push(i);
+		errors += (queue.size() != 4);
+	}
+	while (queue.pop(val)) {
+		errors += (val != next++);
+	}
+	errors += (next != 1000);
+	errors += !queue.empty();
+
+	SensorData sensor;
+	sensor.addLabels("Test sensor", "test", "");
+	TickSample sample;
+	for (unsigned int i = 0; i < TickSample::MAX_READINGS; i++) {
+		errors += !sample.add(sensor, i);
+	}
+	errors += sample.add(sensor, 0);		// Full: dropped.
+	errors += (sample.numReadings != TickSample::MAX_READINGS);
+	sample.time = 1000;
+	sample.apply();
+	errors += (sensor.valueLastAdded() != TickSample::MAX_READINGS - 1);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testSpscQueue. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("SpscQueue checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks Seqlock publishes each value whole, that SeqCounter
+/// readers see writes under way and made, and that a
+/// ReadingsSnapshot holds each registered sensor's values.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testSeqlock() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST Seqlock");
+	unsigned int errors = 0;
+
+	struct Pair { unsigned long a; unsigned long b; };
+	Seqlock<Pair> lock;
+	errors += (lock.version() != 0);
+	errors += (lock.read().a != 0 || lock.read().b != 0);
+	for (unsigned long i = 1; i <= 100; i++) {
+		lock.write(Pair{ i, i * 2 });
+		Pair pair = lock.read();
+		errors += (pair.a != i || pair.b != i * 2);
+	}
+	errors += (lock.version() != 100);
+
+	SeqCounter counter;
+	unsigned int seq = counter.readBegin();
+	errors += counter.readRetry(seq);		// No write: copy is good.
+	counter.beginWrite();
+	errors += !counter.readRetry(seq);		// Write under way.
+	errors += !counter.readRetry(counter.readBegin());
+	counter.endWrite();
+	errors += !counter.readRetry(seq);		// Write made since readBegin().
+	seq = counter.readBegin();
+	errors += counter.readRetry(seq);
+	errors += (counter.writes() != 1);
+
+	typedef SensorRegistry R;
+	SensorRegistry registry;
+	SensorData temp(false), gust(false), other(false);
+	WindDirection dir;
+	registry.add(temp, "Temperature", "temp", "F", "&deg;F", CHART_TEMPERATURE_F, R::ROLE_ALL);
+	registry.add(gust, "Wind Gust", "gust", "mph", "", CHART_WIND_GUST, R::ROLE_ALL);
+	registry.add(dir, "Wind direction", "windDir", "", "&deg;", CHART_WIND_DIRECTION, R::ROLE_ALL);
+	temp.addReading(dataPoint(1000, 60));
+	temp.addReading(dataPoint(1004, 70));
+	gust.addReading(dataPoint(1000, 12));
+	gust.addReading(dataPoint(1004, 8));
+	dir.addReading(1004, 90, 5);
+
+	ReadingsSnapshot snapshot;
+	snapshot.take(registry, dir, 1004);
+	errors += (snapshot.time != 1004 || snapshot.count != 3);
+	const ReadingsSnapshot::Values& t = snapshot.of(registry, temp);
+	errors += (t.avg_now != 65 || t.last != 70 || t.max_today != 70 || t.min_today != 60);
+	errors += (snapshot.of(registry, gust).max_10_min != 12);
+	errors += (abs(snapshot.windAngle_now - 90) > 0.5);
+	errors += (snapshot.of(registry, other).last != 0);	// Not registered.
+
+	// Later readings do not change the published copy.
+	Seqlock<ReadingsSnapshot> readings;
+	readings.write(snapshot);
+	temp.addReading(dataPoint(1008, 90));
+	errors += (readings.read().of(registry, temp).last != 70);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testSeqlock. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("Seqlock checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Queues timer ticks as the ISR does, and checks each tick
+/// taken has its own counts and the periods it ends, and that
+/// ticks lost when the queue is full lose no counts.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testTimerTicks() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST TimerTicks");
+	unsigned int errors = 0;
+	TimerTicks ticks;
+	TimerTicks::Tick tick;
+	errors += ticks.take(tick);				// Empty.
+
+	// Ticks taken late, each with 3 rotations and 10 half-rotations.
+	uint32_t anem = 0, fan = 0;
+	for (uint32_t i = 1; i <= 4; i++) {
+		anem += 3;
+		fan += 10;
+		ticks.onTimer(i * 4000000, anem, fan);
+	}
+	errors += (ticks.pending() != 4);
+	for (uint32_t i = 1; i <= 4; i++) {
+		errors += !ticks.take(tick);
+		errors += (tick.tick != i || tick.time_us != i * 4000000 || tick.periods != 1);
+		errors += (tick.anemRotations != 3 || tick.fanHalfRots != 10);
+		errors += (tick.is_10_min || tick.is_60_min);
+	}
+
+	// Fill the queue, and lose 5 ticks past it.
+	uint32_t n = 4;
+	for (unsigned int i = 0; i < TICK_QUEUE_SIZE + 5; i++) {
+		anem += 3;
+		ticks.onTimer(++n * 4000000, anem, fan);
+	}
+	errors += (ticks.lost() != 5);
+	while (ticks.take(tick)) {}
+	ticks.onTimer(++n * 4000000, anem + 3, fan);
+	errors += !ticks.take(tick);
+	errors += (tick.tick != n || tick.periods != 6 || tick.anemRotations != 18);
+
+	// 10-min and 60-min periods end on their ticks, even if lost.
+	unsigned int count_10_min = 0, count_60_min = 0;
+	for (uint32_t i = n + 1; i <= BASE_PERIODS_IN_60_MIN * 2; i++) {
+		ticks.onTimer(i * 4000000, anem, fan);
+		if (i % 3 == 0 && i < BASE_PERIODS_IN_60_MIN * 2) {
+			continue;						// Leave some queued.
+		}
+		while (ticks.take(tick)) {
+			count_10_min += tick.is_10_min;
+			count_60_min += tick.is_60_min;
+			errors += (tick.is_10_min != (tick.tick % BASE_PERIODS_IN_10_MIN == 0));
+			errors += (tick.is_60_min != (tick.tick % BASE_PERIODS_IN_60_MIN == 0));
+		}
+	}
+	errors += (count_10_min != 12 || count_60_min != 2);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testTimerTicks. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("TimerTicks checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Feeds AnemometerPulses steady and gusting pulse trains, with
+/// bounces and a false pulse, and checks the speeds and 3-s peak.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testAnemometerPulses() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST AnemometerPulses");
+	unsigned int errors = 0;
+	AnemometerPulses anem(DAVIS_SPEED_CAL_FACTOR);
+	errors += (anem.speedInstant(0) != 0 || anem.takePeak() != 0);
+
+	// 4 rotations/s (9 mph) for 6 s, each pulse with a bounce 2 ms later.
+	uint32_t times[64];
+	unsigned int n = 0;
+	uint32_t t = 0xFFF00000;				// micros() wraps during the run.
+	for (unsigned int i = 0; i < 24; i++) {
+		t += 250000;
+		times[n++] = t;
+		times[n++] = t + 2000;
+	}
+	errors += (anem.add(times, n) != 24);
+	errors += (anem.rejected() != 24);
+	errors += (abs(anem.speedInstant(t) - 9) > 0.01);
+	errors += (abs(anem.speedInstant(t + 500000) - 4.5) > 0.01);	// Next pulse overdue.
+	errors += (anem.speedInstant(t + ANEM_CALM_US) != 0);
+	errors += (abs(anem.takePeak() - 9) > 0.01);
+
+	// A false pulse early in a rotation is dropped.
+	n = 0;
+	times[n++] = t + 60000;
+	times[n++] = t + 250000;
+	t += 250000;
+	errors += (anem.add(times, n) != 1);
+	errors += (abs(anem.speedInstant(t) - 9) > 0.01);
+
+	// A 2-s burst at 12 rotations/s (27 mph) between steady wind.
+	n = 0;
+	for (unsigned int i = 0; i < 24; i++) {
+		t += 83333;
+		times[n++] = t;
+	}
+	for (unsigned int i = 0; i < 16; i++) {
+		t += 250000;
+		times[n++] = t;
+	}
+	anem.add(times, n);
+	// The burst's first pulse is taken as a false pulse. The peak
+	// 3-s window holds the rest of the burst (23) and 1 s of steady (4).
+	errors += (anem.rejected() != 26);
+	errors += (abs(anem.takePeak() - 27 * DAVIS_SPEED_CAL_FACTOR / GUST_WINDOW_SEC) > 0.01);
+	errors += (abs(anem.speedInstant(t) - 9) > 0.01);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testAnemometerPulses. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("AnemometerPulses checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks FastTrig sine, cosine and atan2 against libm, at
+/// every whole degree, between degrees, and around the circle.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testFastTrig() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST FastTrig");
+	unsigned int errors = 0;
+	double maxErr_whole = 0, maxErr_between = 0, maxErr_atan2 = 0;
+	for (int deg = -720; deg <= 720; deg++) {
+		double rad = deg * M_PI / 180;
+		maxErr_whole = std::max(maxErr_whole, fabs(FastTrig::sinDeg(deg) - sin(rad)));
+		maxErr_whole = std::max(maxErr_whole, fabs(FastTrig::cosDeg(deg) - cos(rad)));
+	}
+	for (float deg = -360; deg < 720; deg += 0.37f) {
+		double rad = deg * M_PI / 180;
+		maxErr_between = std::max(maxErr_between, fabs(FastTrig::sinDeg(deg) - sin(rad)));
+		maxErr_between = std::max(maxErr_between, fabs(FastTrig::cosDeg(deg) - cos(rad)));
+	}
+	for (float deg = -179.9f; deg < 180; deg += 0.1f) {
+		for (float r = 0.01f; r < 1000; r *= 10) {
+			double rad = deg * M_PI / 180;
+			float y = r * sin(rad), x = r * cos(rad);
+			double diff = fabs(FastTrig::atan2Deg(y, x) - atan2(y, x) * 180 / M_PI);
+			maxErr_atan2 = std::max(maxErr_atan2, std::min(diff, 360 - diff));
+		}
+	}
+	Serial.printf("Max error: sin/cos whole deg %.2e, between %.2e, atan2 %.4f deg\n",
+		maxErr_whole, maxErr_between, maxErr_atan2);
+	errors += (maxErr_whole > 1e-7);
+	errors += (maxErr_between > 4e-5);
+	errors += (maxErr_atan2 > 0.1);
+	errors += (FastTrig::atan2Deg(0, 0) != 0);
+	errors += (FastTrig::atan2Deg(1, 0) != 90 || FastTrig::atan2Deg(0, -1) != 180);
+
+	// Vector average of directions either side of north.
+	WindDirection dir;
+	dir.addReading(0, 350, 5);
+	dir.addReading(4, 10, 5);
+	errors += (std::min(dir.angleAvg_now(), 360 - dir.angleAvg_now()) > 0.1);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testFastTrig. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("FastTrig checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Times libm and FastTrig sine, cosine and atan2, as used
+/// by WindDirection vector averaging.
+/// </summary>
+/// <param name="numAngles">Number of angles to convert.</param>
+void Testing::benchmarkFastTrig(unsigned long numAngles) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.printf("BENCHMARK FastTrig vs libm, %lu angles\n", numAngles);
+	double libmSum = 0;
+	float fastSum = 0;		// Keep the compiler from discarding loops.
+
+	unsigned long timeStart = micros();
+	for (unsigned long i = 0; i < numAngles; i++) {
+		float degrees = i % 360;
+		libmSum += sin(degrees / DEGREES_PER_RADIAN) + cos(degrees / DEGREES_PER_RADIAN);
+	}
+	unsigned long libmSinCos_us = micros() - timeStart;
+	timeStart = micros();
+	for (unsigned long i = 0; i < numAngles; i++) {
+		int degrees = i % 360;
+		fastSum += FastTrig::sinDeg(degrees) + FastTrig::cosDeg(degrees);
+	}
+	unsigned long fastSinCos_us = micros() - timeStart;
+
+	timeStart = micros();
+	for (unsigned long i = 0; i < numAngles; i++) {
+		libmSum += atan2((double)(i % 97) - 48, (double)(i % 89) - 44) * DEGREES_PER_RADIAN;
+	}
+	unsigned long libmAtan2_us = micros() - timeStart;
+	timeStart = micros();
+	for (unsigned long i = 0; i < numAngles; i++) {
+		fastSum += FastTrig::atan2Deg((float)(i % 97) - 48, (float)(i % 89) - 44);
+	}
+	unsigned long fastAtan2_us = micros() - timeStart;
+
+	Serial.printf("libm      sin+cos %8lu us, atan2 %8lu us\n", libmSinCos_us, libmAtan2_us);
+	Serial.printf("FastTrig  sin+cos %8lu us, atan2 %8lu us\n", fastSinCos_us, fastAtan2_us);
+	Serial.printf("(sums %.1f, %.1f)\n", libmSum, fastSum);
+	Serial.println(LINE_SEPARATOR);
+}
+
+/// <summary>
+/// Checks CircularStats sigma-theta against known spreads,
+/// wind rose sectors, merging, the WindDirection roll-up
+/// of 10-min stats into the hour, the day and sigma sensor,
+/// and the rose saved in LittleFS for a restart.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testCircularStats() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST CircularStats");
+	unsigned int errors = 0;
+
+	CircularStats none;
+	errors += (none.sigmaTheta() != 0 || none.sectorPercent(0) != 0);
+
+	// Steady wind either side of north.
+	CircularStats steady;
+	for (int i = 0; i < 10; i++) {
+		steady.add((i % 2 == 0) ? 359 : 0);
+	}
+	errors += (steady.sigmaTheta() > 1);
+	errors += (steady.sectorCount(0) != 10 || steady.sectorPercent(0) != 100);
+
+	// Uniform -10 to +10 deg: standard deviation 6.06 deg.
+	CircularStats spread;
+	for (int deg = -10; deg <= 10; deg++) {
+		spread.add(deg);
+	}
+	Serial.printf("Sigma-theta of -10..10 deg: %.3f (exact 6.055)\n", spread.sigmaTheta());
+	errors += (fabs(spread.sigmaTheta() - 6.055f) > 0.1f);
+
+	// Opposite directions: the Yamartino maximum.
+	CircularStats opposite;
+	opposite.add(90);
+	opposite.add(270);
+	Serial.printf("Sigma-theta of 90, 270 deg: %.2f (max 103.92)\n", opposite.sigmaTheta());
+	errors += (fabs(opposite.sigmaTheta() - 103.92f) > 0.05f);
+
+	// Sectors are centred on N, NNE, ...
+	errors += (CircularStats::sectorOf(11) != 0 || CircularStats::sectorOf(12) != 1);
+	errors += (CircularStats::sectorOf(348) != 15 || CircularStats::sectorOf(349) != 0);
+	errors += (CircularStats::sectorOf(-90) != 12 || CircularStats::sectorOf(450) != 4);
+
+	// Merged stats of two periods equal stats of both.
+	CircularStats first, second, both;
+	for (int deg = 0; deg < 60; deg++) {
+		((deg < 30) ? first : second).add(deg * 3);
+		both.add(deg * 3);
+	}
+	first.merge(second);
+	errors += (first.count() != both.count());
+	errors += (fabs(first.sigmaTheta() - both.sigmaTheta()) > 0.01f);
+	for (unsigned int i = 0; i < CircularStats::SECTORS; i++) {
+		errors += (first.sectorCount(i) != both.sectorCount(i));
+	}
+
+	// WindDirection rolls 10-min stats up, and gives each 10-min
+	// sigma-theta to its sensor. Calm readings are not counted.
+	WindDirection dir;
+	dir.addReading(0, 80, 5);
+	dir.addReading(4, 100, 5);
+	dir.addReading(8, 270, 0.5);
+	errors += (dir.stats(PERIOD_10_MIN).count() != 2);
+	dir.process_data(PERIOD_10_MIN);
+	errors += (dir.stats(PERIOD_10_MIN).count() != 0 || dir.stats(PERIOD_DAY).count() != 2);
+	errors += (fabs(dir.sigmaTheta().valueLastAdded() - 10.05f) > 0.1f);
+	dir.sigmaTheta().process_data(PERIOD_10_MIN);
+	errors += (dir.stats(PERIOD_60_MIN).count() != 0);
+
+	// A calm 10-min period has no sigma-theta, and is left out
+	// of the 60-min sigma-theta.
+	dir.addReading(600, 180, 0.5);
+	dir.process_data(PERIOD_10_MIN);
+	errors += !isnan(dir.sigmaTheta().valueLastAdded());
+	dir.sigmaTheta().process_data(PERIOD_10_MIN);
+	dir.sigmaTheta().process_data(PERIOD_60_MIN);
+	Serial.printf("60-min sigma-theta with a calm period: %.2f\n", dir.sigmaTheta().avg_60_min());
+	errors += (fabs(dir.sigmaTheta().avg_60_min() - 10.05f) > 0.1f);
+	dir.process_data(PERIOD_60_MIN);
+	errors += (dir.stats(PERIOD_60_MIN).count() != 2);
+	String rose = dir.roseString(PERIOD_60_MIN);
+	Serial.printf("Rose: %s\n", rose.c_str());
+	errors += (rose.indexOf("90.0,100.0") < 0);
+	unsigned int numSectors = 1;
+	for (unsigned int i = 0; i < rose.length(); i++) {
+		numSectors += (rose[i] == '~');
+	}
+	errors += (numSectors != CircularStats::SECTORS);
+	dir.process_data(PERIOD_DAY);
+	errors += (dir.stats(PERIOD_DAY).count() != 0 || dir.stats(PERIOD_60_MIN).count() != 2);
+
+	// The rose saved at each period end is restored the same
+	// day, and the hourly stats only the same hour.
+	const unsigned long noon = 1700000000UL / 86400 * 86400 + 12 * 3600UL;
+	LittleFS.mkdir(SENSOR_DATA_DIR_PATH.c_str());
+	LittleFS.remove((SENSOR_DATA_DIR_PATH + "/roseTest_rose.bin").c_str());
+	WindDirection saved;
+	saved.addLabels("Rose test", "roseTest", "");
+	errors += saved.recoverRose(noon);	// No file yet.
+	saved.addReading(noon + 4, 90, 5);
+	saved.addReading(noon + 8, 100, 5);
+	saved.addReading(noon + 600, 95, 5);
+	setTime(noon + 600);
+	saved.process_data(PERIOD_10_MIN);
+	WindDirection restarted;
+	restarted.addLabels("Rose test", "roseTest", "");
+	errors += !restarted.recoverRose(noon + 700);
+	errors += (restarted.stats(PERIOD_DAY).count() != 3);
+	setTime(noon + 700);
+	restarted.process_data(PERIOD_60_MIN);
+	errors += (restarted.stats(PERIOD_60_MIN).count() != 3);
+	WindDirection nextHour;
+	nextHour.addLabels("Rose test", "roseTest", "");
+	errors += !nextHour.recoverRose(noon + 3700);
+	errors += (nextHour.stats(PERIOD_DAY).count() != 3 || nextHour.stats(PERIOD_60_MIN).count() != 0);
+	WindDirection nextDay;
+	nextDay.addLabels("Rose test", "roseTest", "");
+	errors += nextDay.recoverRose(noon + 86400);
+	errors += (nextDay.stats(PERIOD_DAY).count() != 0);
+	File file = LittleFS.open((SENSOR_DATA_DIR_PATH + "/roseTest_rose.bin").c_str(), "r+");
+	file.seek(20);
+	file.write((const uint8_t*)"x", 1);
+	file.close();
+	WindDirection corrupted;
+	corrupted.addLabels("Rose test", "roseTest", "");
+	errors += corrupted.recoverRose(noon + 700);
+	errors += (corrupted.stats(PERIOD_DAY).count() != 0);
+	LittleFS.remove((SENSOR_DATA_DIR_PATH + "/roseTest_rose.bin").c_str());
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testCircularStats. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("CircularStats checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks WindAggregator sustained wind, gust and peak wind
+/// against the NWS definitions, and the period values that
+/// sensors save from them.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testWindAggregator() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST WindAggregator");
+	unsigned int errors = 0;
+	WindAggregator wind;
+
+	// Steady 10 mph: sustained 10, no gust or peak wind.
+	for (unsigned int i = 0; i < BASE_PERIODS_IN_10_MIN; i++) {
+		wind.add(10, 10);
+	}
+	errors += (fabs(wind.sustained() - 10) > 0.001f || wind.gust() != 0 || wind.peakWind() != 0);
+
+	// The sustained wind follows a change within 2 min.
+	for (unsigned int i = 0; i < SUSTAINED_WIND_PERIODS; i++) {
+		wind.add(22, 22);
+	}
+	errors += (fabs(wind.sustained() - 22) > 0.001f);
+	errors += (wind.lull() != 10 || wind.peak() != 22);
+	errors += (wind.gust() != 22);		// 12 mph above the lull.
+
+	// A 30-mph peak is a peak wind once, and a gust for 10 min.
+	wind.add(22, 30);
+	errors += (wind.peakWind() != 30 || wind.gust() != 30);
+	wind.add(22, 22);
+	errors += (wind.peakWind() != 0 || wind.gust() != 30);
+	for (unsigned int i = 0; i < BASE_PERIODS_IN_10_MIN; i++) {
+		wind.add(22, 25);
+	}
+	Serial.printf("After 10 min of 22 mph: lull %.1f, peak %.1f, gust %.1f\n",
+		wind.lull(), wind.peak(), wind.gust());
+	errors += (wind.lull() != 22 || wind.peak() != 25 || wind.gust() != 0);
+
+	// Steady rise, then steady fall, each past the 10-min window:
+	// the windows fill to their full size, where the extremes are
+	// the oldest and newest values. Checked after every period.
+	for (int direction = 1; direction >= -1; direction -= 2) {
+		wind.clear();
+		const unsigned int numPeriods = 2 * BASE_PERIODS_IN_10_MIN;
+		auto speedAt = [direction](unsigned int i) {
+			return (direction > 0) ? i * 0.2f : 60 - i * 0.2f;
+		};
+		unsigned int mismatches = 0;
+		for (unsigned int i = 0; i < numPeriods; i++) {
+			wind.add(speedAt(i), speedAt(i) + 1);
+			unsigned int oldest_2_min = (i + 1 > SUSTAINED_WIND_PERIODS) ? i + 1 - SUSTAINED_WIND_PERIODS : 0;
+			unsigned int oldest_10_min = (i + 1 > BASE_PERIODS_IN_10_MIN) ? i + 1 - BASE_PERIODS_IN_10_MIN : 0;
+			float sustained = (speedAt(oldest_2_min) + speedAt(i)) / 2;
+			float lull = std::min(speedAt(oldest_10_min), speedAt(i));
+			float peak = std::max(speedAt(oldest_10_min), speedAt(i)) + 1;
+			mismatches += (fabs(wind.sustained() - sustained) > 0.01f);
+			mismatches += (fabs(wind.lull() - lull) > 0.001f || fabs(wind.peak() - peak) > 0.001f);
+		}
+		Serial.printf("Steady %s: sustained %.2f, lull %.2f, peak %.2f, %u mismatches\n",
+			(direction > 0) ? "rise" : "fall", wind.sustained(), wind.lull(), wind.peak(), mismatches);
+		errors += (mismatches != 0);
+	}
+
+	// Period values.
+	SensorData avg(false, false, false), last(false, false, false), max(false, false, false);
+	last.setPeriodValue(PERIOD_VALUE_LAST);
+	max.setPeriodValue(PERIOD_VALUE_MAX);
+	for (unsigned int period = 0; period < 6; period++) {
+		float values[] = { 1, 5, (float)period };
+		for (float value : values) {
+			avg.addReading(dataPoint(period * 600, value));
+			last.addReading(dataPoint(period * 600, value));
+			max.addReading(dataPoint(period * 600, value));
+		}
+		avg.process_data(PERIOD_10_MIN);
+		last.process_data(PERIOD_10_MIN);
+		max.process_data(PERIOD_10_MIN);
+	}
+	errors += (fabs(avg.avg_10_min() - 11 / 3.0f) > 0.001f);
+	errors += (last.avg_10_min() != 5 || max.avg_10_min() != 5);
+	avg.process_data(PERIOD_60_MIN);
+	last.process_data(PERIOD_60_MIN);
+	max.process_data(PERIOD_60_MIN);
+	errors += (fabs(avg.avg_60_min() - 2.833f) > 0.001f);
+	errors += (last.avg_60_min() != 5 || max.avg_60_min() != 5);
+	last.addReading(dataPoint(6 * 600, 4));
+	last.process_data(PERIOD_10_MIN);
+	last.process_data(PERIOD_60_MIN);
+	errors += (last.avg_60_min() != 4);
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testWindAggregator. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("WindAggregator checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks CompactSeries against a RingBuffer holding the same
+/// points: values within half a count, times on the period grid,
+/// gaps starting runs, wrap at capacity and clamping. Also checks
+/// that list functions and SeriesWriter read both alike.
+/// </summary>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testCompactSeries() {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST CompactSeries");
+	unsigned int errors = 0;
+	const unsigned long start = 1700000000UL;
+	const unsigned int period = 600;
+	FixedCompactSeries<24> compact(period);
+	FixedRingBuffer<dataPoint, 24> ring;
+
+	// Jittered times, twice round the buffer.
+	for (unsigned int i = 0; i < 48; i++) {
+		long jitter = (long)(i % 7) * 40 - 120;
+		dataPoint dp(start + i * period + jitter, 20 + 15 * sinf(i * 0.3f));
+		addToList(compact, dp, compact.capacity());
+		addToList(ring, dp, ring.capacity());
+	}
+	errors += (compact.size() != ring.size() || !compact.full());
+	for (unsigned int i = 0; i < compact.size(); i++) {
+		unsigned long expectedTime = compact.front().time + i * period;
+		errors += (compact[i].time != expectedTime);
+		errors += (fabs(compact[i].value - ring[i].value) > compact.scale() / 2 + 0.0001f);
+	}
+	errors += (labs((long)(compact.back().time - ring.back().time)) > (long)period / 2);
+	errors += (fabs(listAverage(compact, 24) - listAverage(ring, 24)) > compact.scale());
+	errors += (fabs(listMaximum(compact, 6) - listMaximum(ring, 6)) > compact.scale());
+
+	// Text for charts, through SeriesWriter and listToString_data.
+	String expected = listToString_data(compact, false, 2);
+	String actual;
+	char buffer[64 + 1];
+	size_t n;
+	SeriesWriter writer(compact, false, 2);
+	while ((n = writer.read(buffer, 64)) > 0) {
+		buffer[n] = '\0';
+		actual += buffer;
+	}
+	errors += (actual != expected || actual.length() == 0);
+
+	// A gap starts a run; times either side of it are kept.
+	compact.clear();
+	for (unsigned int i = 0; i < 10; i++) {
+		compact.push_back(dataPoint(start + i * period, i));
+	}
+	unsigned long afterGap = start + 20 * period;
+	for (unsigned int i = 0; i < 5; i++) {
+		compact.push_back(dataPoint(afterGap + i * period, 10 + i));
+	}
+	errors += (compact.size() != 15);
+	errors += (compact[9].time != start + 9 * period || compact[10].time != afterGap);
+	errors += (compact[14].time != afterGap + 4 * period || fabs(compact[14].value - 14) > 0.001f);
+
+	// More gaps lose no points.
+	unsigned long afterGap2 = afterGap + 50 * period + 17;
+	compact.push_back(dataPoint(afterGap2, 99));
+	errors += (compact.size() != 16 || compact.front().time != start);
+	errors += (compact[14].time != afterGap + 4 * period);
+	errors += (compact.back().time != afterGap2 || fabs(compact.back().value - 99) > 0.001f);
+
+	// A gap before every point: each is its own run, and only
+	// a full series drops its oldest point.
+	compact.clear();
+	FixedRingBuffer<dataPoint, 24> gapped;
+	for (unsigned int i = 0; i < 30; i++) {
+		dataPoint dp(start + i * 3 * period + (i % 5) * 7, i);
+		addToList(compact, dp, compact.capacity());
+		addToList(gapped, dp, gapped.capacity());
+	}
+	errors += (compact.size() != gapped.size());
+	for (unsigned int i = 0; i < gapped.size(); i++) {
+		errors += (compact[i].time != gapped[i].time || compact[i].value != gapped[i].value);
+	}
+
+	// Popping through run boundaries.
+	for (unsigned int i = 0; i < 23; i++) {
+		compact.pop_front();
+	}
+	errors += (compact.size() != 1 || compact.front().time != gapped.back().time);
+	compact.pop_front();
+	errors += !compact.empty();
+
+	// NaN, such as a failed reading, stays NaN, so charts show a gap.
+	compact.push_back(dataPoint(start, NAN));
+	compact.push_back(dataPoint(start + period, 5));
+	errors += (!isnan(compact[0].value) || fabs(compact[1].value - 5) > 0.001f);
+	compact.clear();
+
+	// Values beyond the int16 range are clamped and counted; scale widens it.
+	compact.push_back(dataPoint(start, 1013.2f));
+	compact.push_back(dataPoint(start + period, -1013.2f));
+	errors += (fabs(compact[0].value - 327.67f) > 0.001f || fabs(compact[1].value + 327.67f) > 0.001f);
+	errors += (compact.clamped() != 2);
+	compact.setScale(0.1f);
+	errors += !compact.empty();
+	compact.push_back(dataPoint(start, 1013.2f));
+	errors += (fabs(compact[0].value - 1013.2f) > 0.05f);
+
+	// Copies keep points and times.
+	for (unsigned int i = 1; i < 10; i++) {
+		compact.push_back(dataPoint(start + i * period, 1000 + i));
+	}
+	FixedCompactSeries<24> copy(compact);
+	FixedCompactSeries<4> shortCopy(period);
+	shortCopy = compact;
+	errors += (copy.size() != 10 || copy.back().time != compact.back().time);
+	errors += (shortCopy.size() != 4 || shortCopy.front().time != compact[6].time);
+
+	Serial.printf("Size of %u points: CompactSeries %u bytes, RingBuffer %u bytes\n",
+		SIZE_10_MIN_LIST, (unsigned int)sizeof(FixedCompactSeries<SIZE_10_MIN_LIST>),
+		(unsigned int)sizeof(FixedRingBuffer<dataPoint, SIZE_10_MIN_LIST>));
+
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testCompactSeries. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("CompactSeries checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
+
+/// <summary>
+/// Checks SeriesArchive with a year of hourly temperatures: every
+/// point comes back within half the resolution, range queries give
+/// exactly the points in range, reduced queries keep extremes, and
+/// coding continues after reopening. Also checks that the oldest
+/// blocks are reused and that a bad block is skipped.
+/// </summary>
+/// <param name="fs">File system for the test file.</param>
+/// <returns>Number of failed checks.</returns>
+unsigned int Testing::testSeriesArchive(fs::FS& fs) {
+	Serial.println(LINE_SEPARATOR);
+	Serial.println("TEST SeriesArchive");
+	const char* path = "/seriesArchiveTest.arc";
+	const unsigned long start = 1700000000UL;
+	const unsigned int numPoints = 365 * 24;
+	const float resolution = 0.01;
+	unsigned int errors = 0;
+	fs.remove(path);
+
+	// Daily and yearly cycles with noise; times a few seconds late.
+	auto temperature = [](unsigned int i) {
+		return 50 + 25 * sinf(i * 2 * (float)M_PI / (365 * 24)) + 10 * sinf(i * 2 * (float)M_PI / 24)
+			+ ((i * 7919) % 100) / 50.0f;
+	};
+	auto pointTime = [start](unsigned int i) {
+		return start + i * 3600UL + (i * 13) % 5;
+	};
+	SeriesArchive archive(ARCHIVE_60_MIN_BLOCKS, resolution);
+	errors += !archive.begin(fs, path, "test");
+	for (unsigned int i = 0; i < numPoints / 2; i++) {
+		errors += !archive.append(dataPoint(pointTime(i), temperature(i)));
+	}
+	// Reopen, as after reboot, and continue.
+	SeriesArchive reopened(ARCHIVE_60_MIN_BLOCKS, resolution);
+	errors += !reopened.begin(fs, path, "test");
+	for (unsigned int i = numPoints / 2; i < numPoints; i++) {
+		errors += !reopened.append(dataPoint(pointTime(i), temperature(i)));
+	}
+	unsigned int index = 0;
+	unsigned int found = reopened.query(0, 0xFFFFFFFF, [&](const dataPoint& dp) {
+		errors += (dp.time != pointTime(index));
+		errors += (fabs(dp.value - temperature(index)) > resolution / 2);
+		index++;
+		});
+	errors += (found != numPoints);
+	float bytesPerPoint = (float)reopened.blocksUsed() * sizeof(SeriesArchive::Block) / numPoints;
+	Serial.printf("%u points in %u of %u blocks, %.2f bytes per point (SeriesStore: %.2f)\n",
+		numPoints, reopened.blocksUsed(), ARCHIVE_60_MIN_BLOCKS, bytesPerPoint,
+		(float)sizeof(SeriesStore::Block) / SeriesStore::RECORDS_PER_BLOCK);
+	errors += (reopened.blocksUsed() >= ARCHIVE_60_MIN_BLOCKS);	// A year fits.
+
+	// A range gives exactly the points in it.
+	unsigned long timeFrom = pointTime(1000) - 1, timeTo = pointTime(1999);
+	index = 1000;
+	found = reopened.query(timeFrom, timeTo, [&](const dataPoint& dp) {
+		errors += (dp.time != pointTime(index++));
+		});
+	errors += (found != 1000);
+
+	// Reduced to a list, the extremes are kept.
+	FixedRingBuffer<dataPoint, 50> reduced;
+	float maxValue = -999999, sum = 0;
+	for (unsigned int i = 1000; i < 2000; i++) {
+		maxValue = std::max(maxValue, temperature(i));
+		sum += temperature(i);
+	}
+	errors += (reopened.query(timeFrom, timeTo, reduced, PERIOD_VALUE_MAX) != 50);
+	errors += (fabs(listMaximum(reduced, 50) - maxValue) > resolution / 2);
+	errors += (reduced.front().time < timeFrom || reduced.back().time > timeTo);
+	reopened.query(timeFrom, timeTo, reduced);
+	errors += (reduced.size() != 50 || fabs(listAverage(reduced, 50) - sum / 1000) > 0.5f);
+
+	// Large values, zero, repeats and a time step back.
+	SeriesArchive small(2, 0.1f);
+	errors += !small.begin(fs, path, "small");
+	dataPoint odd[] = { dataPoint(start, 1013.2f), dataPoint(start + 60, 0), dataPoint(start + 120, 0),
+		dataPoint(start + 100, -40.04f), dataPoint(start + 86400 * 400UL, 123456.7f) };
+	for (const dataPoint& dp : odd) {
+		small.append(dp);
+	}
+	index = 0;
+	found = small.query(0, 0xFFFFFFFF, [&](const dataPoint& dp) {
+		errors += (dp.time != odd[index].time || fabs(dp.value - odd[index].value) > 0.05f);
+		index++;
+		});
+	errors += (found != 5);
+
+	// Appending past the last block reuses the oldest.
+	for (unsigned int i = 0; i < 2000; i++) {
+		small.append(dataPoint(start + i * 3600UL, i));
+	}
+	dataPoint first, last;
+	found = small.query(0, 0xFFFFFFFF, [&](const dataPoint& dp) {
+		if (first.time == 0) {
+			first = dp;
+		}
+		last = dp;
+		});
+	errors += (small.blocksUsed() != 2 || found == 0 || found >= 2000);
+	errors += (last.time != start + 1999 * 3600UL || last.value != 1999);
+	errors += (first.value != 2000 - found);
+
+	// Corrupt one byte of the older block; only that block is lost.
+	File file = fs.open(path, "r+");
+	uint32_t seqs[2] = { 0, 0 };
+	for (unsigned int slot = 0; slot < 2; slot++) {
+		file.seek(sizeof(SeriesArchive::Header) + slot * sizeof(SeriesArchive::Block));
+		file.read((uint8_t*)&seqs[slot], sizeof(seqs[slot]));
+	}
+	unsigned int olderSlot = (seqs[0] < seqs[1]) ? 0 : 1;
+	file.seek(sizeof(SeriesArchive::Header) + olderSlot * sizeof(SeriesArchive::Block) + 30);
+	file.write((uint8_t)0xFF);
+	file.close();
+	SeriesArchive corrupted(2, 0.1f);
+	corrupted.begin(fs, path, "small");
+	unsigned int foundAfter = corrupted.query(0, 0xFFFFFFFF, [](const dataPoint&) {});
+	errors += (foundAfter == 0 || foundAfter >= found);
+	errors += !corrupted.append(dataPoint(start + 2000 * 3600UL, 2000));
+
+	fs.remove(path);
+	if (errors > 0) {
+		Serial.printf("ERROR: Testing::testSeriesArchive. %u checks failed.\n", errors);
+	}
+	else {
+		Serial.println("SeriesArchive checks passed.");
+	}
+	Serial.println(LINE_SEPARATOR);
+	return errors;
+}
@@ -17,6 +17,25 @@ using std::list;
 #include "App_settings.h"
 #include "ListFunctions.h"
 #include "SensorData.h"
+#include "LogBuffer.h"
+#include "SensorRegistry.h"
+#include "Placeholders.h"
+#include "PageCache.h"
+#include "SensorSimulate.h"
+#include "Replay.h"
+#include "PhaseTimer.h"
+#include "SensorScheduler.h"
+#include "TickSample.h"
+#include "SpscQueue.h"
+#include "Seqlock.h"
+#include "ReadingsSnapshot.h"
+#include "TimerTicks.h"
+#include "AnemometerPulses.h"
+#include "FastTrig.h"
+#include "CircularStats.h"
+#include "WindAggregator.h"
+#include "CompactSeries.h"
+#include "SeriesArchive.h"
 using namespace ListFunctions;
 using namespace App_Settings;
 
@@ -58,6 +77,86 @@ public:
 
 	//void test();
 
+	// Compares insert and iterate cost of RingBuffer and std::list.
+	void benchmarkRingBuffer(unsigned long numInserts);
+
+	// Checks SlidingWindow results against brute force.
+	unsigned int testSlidingWindow(unsigned int windowSize, unsigned long numValues);
+
+	// Checks SeriesWriter output against listToString_data.
+	unsigned int testSeriesWriter();
+
+	// Checks SeriesStore round trip and recovery.
+	unsigned int testSeriesStore(fs::FS& fs);
+
+	// Compares byte-at-a-time and block file reads.
+	void benchmarkFileRead(fs::FS& fs, size_t fileSize, unsigned int repeats);
+
+	// Checks LogBuffer wrap-around, peek/consume and dropping when full.
+	unsigned int testLogBuffer();
+
+	// Checks SensorRegistry lookups and period processing by role.
+	unsigned int testSensorRegistry();
+
+	// Checks placeholder names round trip, and every placeholder in a page is found.
+	unsigned int testPlaceholders(const String& page);
+
+	// Times rendering a page with the baseline processor() if-chain and the sorted table.
+	unsigned int benchmarkPlaceholders(const String& page, unsigned int repeats);
+
+	// Checks PageCache rendering, epochs and ETags.
+	unsigned int testPageCache(fs::FS& fs);
+
+	/// <summary>
+	/// Time of one benchmarked operation.
+	/// </summary>
+	struct BenchmarkResult {
+		const char* name;	// Operation benchmarked.
+		float nsPerOp;		// Mean time per operation, ns.
+	};
+
+	// Times the per-tick sensor pipeline operations, with simulated readings.
+	unsigned int benchmarkPipeline(BenchmarkResult* results, unsigned int maxResults, unsigned long iterations);
+
+	// Replays days of simulated ticks and checks periods processed and list sizes.
+	unsigned int testReplay(unsigned int days);
+
+	// Checks PhaseHistogram buckets and percentiles, and the PhaseTimer report.
+	unsigned int testPhaseTimer();
+
+	// Checks SensorScheduler reads each sensor on its phase, and spreads reads over ticks.
+	unsigned int testSensorScheduler();
+
+	// Checks SpscQueue order, full and empty, and wrap-around, and TickSample capacity.
+	unsigned int testSpscQueue();
+
+	// Checks Seqlock and SeqCounter, and that ReadingsSnapshot holds each sensor's values.
+	unsigned int testSeqlock();
+
+	// Checks TimerTicks gives each tick its own counts and periods, and loses no counts when full.
+	unsigned int testTimerTicks();
+
+	// Checks AnemometerPulses drops bounces and false pulses, and finds the 3-s peak.
+	unsigned int testAnemometerPulses();
+
+	// Checks FastTrig sine, cosine and atan2 against libm.
+	unsigned int testFastTrig();
+
+	// Compares libm and FastTrig sine, cosine and atan2 times.
+	void benchmarkFastTrig(unsigned long numAngles);
+
+	// Checks CircularStats sigma-theta, wind rose sectors and roll-up.
+	unsigned int testCircularStats();
+
+	// Checks WindAggregator sustained wind, gust and peak wind, and sensor period values.
+	unsigned int testWindAggregator();
+
+	// Checks CompactSeries against a RingBuffer: values, times, gaps, wrap and clamping.
+	unsigned int testCompactSeries();
+
+	// Checks SeriesArchive round trip, range queries, reduction, reopening, wrap and a bad block.
+	unsigned int testSeriesArchive(fs::FS& fs);
+
 	String readData();
 };
 
@@ -0,0 +1,32 @@
+// 
+// 
+// 
+
+#include "TickSample.h"
+
+/// <summary>
+/// Adds a reading of a sensor.
+/// </summary>
+/// <returns>False, and the reading is dropped, if the sample is full.</returns>
+bool TickSample::add(SensorData& sensor, float value) {
+	if (numReadings >= MAX_READINGS) {
+		String label = sensor.label();
+		Serial.printf("ERROR: TickSample is full; reading of %s dropped.\n",
+			(label.length() > 0) ? label.c_str() : "unlabelled sensor");
+		return false;
+	}
+	Reading& reading = readings[numReadings++];
+	reading.sensor = &sensor;
+	reading.value = value;
+	return true;
+}
+
+/// <summary>
+/// Adds the readings to their sensors, at the sample time.
+/// Processing task only.
+/// </summary>
+void TickSample::apply() const {
+	for (unsigned int i = 0; i < numReadings; i++) {
+		readings[i].sensor->addReading(dataPoint(time, readings[i].value));
+	}
+}
@@ -0,0 +1,67 @@
+// TickSample.h
+
+#ifndef _TICKSAMPLE_h
+#define _TICKSAMPLE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "SensorData.h"
+
+/// <summary>
+/// Readings of one base period, taken by the acquisition task
+/// and queued for the processing task, which adds them to the
+/// SensorData lists and does the period processing that the
+/// flags call for. Wind is kept as raw counts, because speed,
+/// gusts and direction are derived from the lists' averages.
+/// </summary>
+struct TickSample {
+
+	static const unsigned int MAX_READINGS = 12;	// Most readings in one base period.
+
+	/// <summary>
+	/// What a sample holds and calls for (combine with |).
+	/// </summary>
+	enum sampleFlag : uint8_t {
+		SAMPLE_READ = 0x01,		// Sensors read (base period handled).
+		SAMPLE_10_MIN = 0x02,	// Process 10-min period after readings.
+		SAMPLE_60_MIN = 0x04,	// Process 60-min period after readings.
+		SAMPLE_NEW_DAY = 0x08	// Process day after readings.
+	};
+
+	/// <summary>
+	/// A reading of a sensor.
+	/// </summary>
+	struct Reading {
+		SensorData* sensor;		// Sensor that takes the reading.
+		float value;			// Reading.
+	};
+
+	unsigned long time = 0;			// now() when read.
+	uint8_t flags = 0;				// sampleFlag values.
+	uint8_t numReadings = 0;		// Readings held.
+	unsigned int anemRotations = 0;	// Anemometer rotations in base period.
+	float windAngle = 0;			// Wind vane angle, deg.
+	float gust_3s = 0;				// Peak 3-s mean wind speed, mph (0 if pulses not timed).
+	float speed_now = -1;			// Speed of last rotation when vane read, mph (-1 if pulses not timed).
+	Reading readings[MAX_READINGS];
+
+	/// <summary>
+	/// Adds a reading of a sensor.
+	/// </summary>
+	/// <returns>False, and the reading is dropped, if the sample is full.</returns>
+	bool add(SensorData& sensor, float value);
+
+	/// <summary>
+	/// Adds the readings to their sensors, at the sample time.
+	/// Processing task only.
+	/// </summary>
+	void apply() const;
+
+	bool has(uint8_t flag) const { return (flags & flag) == flag; }
+};
+
+#endif
@@ -0,0 +1,59 @@
+// 
+// 
+// 
+
+#include "TimerTicks.h"
+
+/// <summary>
+/// Queues a tick. Called from the timer ISR.
+/// </summary>
+void IRAM_ATTR TimerTicks::onTimer(uint32_t time_us, uint32_t anemRotations, uint32_t fanHalfRots) {
+	Event event;
+	event.tick = ++_tick;
+	event.time_us = time_us;
+	event.anemRotations = anemRotations;
+	event.fanHalfRots = fanHalfRots;
+	_events.push(event);	// If full, the next event carries the counts.
+}
+
+/// <summary>
+/// Takes the oldest queued tick. Acquisition task only.
+/// </summary>
+/// <param name="tick">Set to the tick taken.</param>
+/// <returns>False if no tick is queued.</returns>
+bool TimerTicks::take(Tick& tick) {
+	Event event;
+	if (!_events.pop(event)) {
+		return false;
+	}
+	tick.tick = event.tick;
+	tick.time_us = event.time_us;
+	tick.periods = event.tick - _last.tick;
+	tick.anemRotations = event.anemRotations - _last.anemRotations;
+	tick.fanHalfRots = event.fanHalfRots - _last.fanHalfRots;
+	tick.is_10_min = endsPeriod(_last.tick, event.tick, App_Settings::BASE_PERIODS_IN_10_MIN);
+	tick.is_60_min = endsPeriod(_last.tick, event.tick, App_Settings::BASE_PERIODS_IN_60_MIN);
+	_last = event;
+	return true;
+}
+
+/// <summary>
+/// Sets the current date (TimeLib) as the day to compare with.
+/// </summary>
+void TimerTicks::startDay() {
+	_oldDay = day();
+	_oldMonth = month();
+	_oldYear = year();
+}
+
+/// <summary>
+/// Returns true, once, when the date (TimeLib) is past the day
+/// set by startDay() or the last new day.
+/// </summary>
+bool TimerTicks::takeNewDay() {
+	if (day() > _oldDay || month() > _oldMonth || year() > _oldYear) {
+		startDay();
+		return true;
+	}
+	return false;
+}
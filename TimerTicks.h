@@ -0,0 +1,106 @@
+// TimerTicks.h
+
+#ifndef _TIMERTICKS_h
+#define _TIMERTICKS_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <TimeLib.h>
+#include "App_Settings.h"
+#include "SpscQueue.h"
+
+/// <summary>
+/// Queues base timer interrupts for the acquisition task, each
+/// with its time and the anemometer and fan counts at that
+/// moment. The timer ISR calls onTimer(); the acquisition task
+/// calls take() for each tick in turn, which gives the counts of
+/// that tick's base period and the 10-min and 60-min periods it
+/// ends. A tick taken late still gets its own counts and time,
+/// so no base period is discarded. The replay engine drives the
+/// same queue from a virtual clock.
+/// </summary>
+class TimerTicks {
+
+public:
+
+	/// <summary>
+	/// A base period, as given by take().
+	/// </summary>
+	struct Tick {
+		uint32_t tick;				// Base periods since start (first is 1).
+		uint32_t time_us;			// micros() at the interrupt.
+		unsigned int periods;		// Base periods covered (more than 1 if ticks were lost).
+		uint32_t anemRotations;		// Anemometer rotations in the periods covered.
+		uint32_t fanHalfRots;		// Fan half-rotations in the periods covered.
+		bool is_10_min;				// Ends a 10-min period.
+		bool is_60_min;				// Ends a 60-min period.
+	};
+
+	/// <summary>
+	/// Queues a tick. Called from the timer ISR.
+	/// </summary>
+	/// <param name="time_us">micros() at the interrupt.</param>
+	/// <param name="anemRotations">Anemometer rotations since start.</param>
+	/// <param name="fanHalfRots">Fan half-rotations since start.</param>
+	void IRAM_ATTR onTimer(uint32_t time_us, uint32_t anemRotations, uint32_t fanHalfRots);
+
+	/// <summary>
+	/// Takes the oldest queued tick. Acquisition task only.
+	/// </summary>
+	/// <param name="tick">Set to the tick taken.</param>
+	/// <returns>False if no tick is queued.</returns>
+	bool take(Tick& tick);
+
+	/// <summary>
+	/// Returns the number of ticks waiting to be taken.
+	/// </summary>
+	unsigned int pending() const { return _events.size(); }
+
+	/// <summary>
+	/// Returns the number of ticks lost because the queue was full.
+	/// Their counts are given with the next tick taken.
+	/// </summary>
+	unsigned long lost() const { return _events.dropped(); }
+
+	/// <summary>
+	/// Sets the current date (TimeLib) as the day to compare with.
+	/// </summary>
+	void startDay();
+
+	/// <summary>
+	/// Returns true, once, when the date (TimeLib) is past the day
+	/// set by startDay() or the last new day.
+	/// </summary>
+	bool takeNewDay();
+
+private:
+
+	/// <summary>
+	/// A timer interrupt, as queued by the ISR. Counts are
+	/// totals since start, so a lost event loses no counts.
+	/// </summary>
+	struct Event {
+		uint32_t tick;
+		uint32_t time_us;
+		uint32_t anemRotations;
+		uint32_t fanHalfRots;
+	};
+
+	SpscQueue<Event, App_Settings::TICK_QUEUE_SIZE> _events;	// ISR to acquisition task.
+	uint32_t _tick = 0;		// Ticks counted (ISR).
+	Event _last = {};		// Last event taken (acquisition task).
+
+	int _oldDay = 0;		// Day of previous day.
+	int _oldMonth = 0;		// Month of previous day.
+	int _oldYear = 0;		// Year of previous day.
+
+	static bool endsPeriod(uint32_t lastTick, uint32_t tick, uint32_t periods) {
+		return tick / periods != lastTick / periods;
+	}
+};
+
+#endif
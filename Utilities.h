@@ -89,6 +89,16 @@ namespace Utilities {
 	/// <returns>"Yes" or "No".</returns>
 	String bool_Yes_No(bool val);
 
+	/// <summary>
+	/// Returns CRC-32 (IEEE 802.3) of a block of bytes. Pass a 
+	/// previous result as crc to continue over several blocks.
+	/// </summary>
+	/// <param name="data">Bytes to check.</param>
+	/// <param name="length">Number of bytes.</param>
+	/// <param name="crc">CRC of preceding bytes (0 to start).</param>
+	/// <returns>CRC-32 of the bytes.</returns>
+	uint32_t crc32(const void* data, size_t length, uint32_t crc = 0);
+
 }
 
 #endif
@@ -68,6 +68,18 @@ using namespace FileOperations;
 #include "SensorData.h"
 #include "WindSpeed2.h"
 #include "WindDirection.h"
+#include "WindAggregator.h"
+#include "SensorRegistry.h"
+#include "SensorScheduler.h"
+#include "TickSample.h"
+#include "SpscQueue.h"
+#include "Seqlock.h"
+#include "ReadingsSnapshot.h"
+#include "Placeholders.h"
+#include "PageCache.h"
+#include "TimerTicks.h"
+#include "AnemometerPulses.h"
+#include "PhaseTimer.h"
 #include "DebugFlags.h"
 
 
@@ -98,18 +110,10 @@ SensorData d_Insol(true, true);		// Insolation readings (no minima).
 SensorData d_IRSky_C;				// IR sky temperature readings.
 SensorData d_fanRPM(false);			// Fan RPM readings.
 
-//list<SensorData> _sensors = {
-//	d_Temp_F,
-//	d_Pres_mb,
-//	d_Pres_seaLvl_mb,
-//	d_Temp_for_RH_C,
-//	d_RH,
-//	d_UVA,
-//	d_UVB,
-//	d_UVIndex,
-//	d_Insol,
-//	d_IRSky_C,
-//	d_fanRPM };
+// Registered SensorData instances (see sensors_register()).
+SensorRegistry sensors;
+// Sensor reads spread over base periods (see sensors_schedule()).
+SensorScheduler sensorSchedule;
 
 //#if defined(VM_DEBUG)
 SensorSimulate dummy_Temp_F;			// Temperature readings.
@@ -143,11 +147,23 @@ bool _isGood_LITTLEFS = false;
 bool _isGood_fan = false;
 // %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 
-unsigned long _timeStart_Loop = 0;			//monitor loop timing
+TimerTicks timerTicks;		// Timer ticks queued for sensor reads and 10-min, 60-min averages.
+PhaseTimer phaseTimer;		// Durations of task phases (see "/metrics").
 
-volatile int _countInterrupts_base = 0;		// Timer interrupts for sensor reads.
-volatile long _countInterrupts_10_min = 0;	// Timer interrupts for sensor for 10-min averages.
-volatile long _countInterrupts_60_min = 0;	// Timer interrupts for sensor for 60-min averages.
+// ==========   Acquisition and processing tasks   ========== //
+/*
+ The acquisition task (core 1) is woken by the base timer. It
+ reads wind, fan and the sensors due on the tick into a
+ TickSample, flags the 10-min, 60-min and day periods that end
+ with it, and pushes it to sampleQueue. The processing task
+ (core 0) pops samples in order, adds their readings to the
+ SensorData lists, processes periods and writes files. loop()
+ only checks WiFi. A WiFi reconnection or a slow write delays
+ processing, but not reads; up to SAMPLE_QUEUE_SIZE samples wait.
+*/
+SpscQueue<TickSample, SAMPLE_QUEUE_SIZE> sampleQueue;	// Acquisition to processing.
+TaskHandle_t acquisitionTask = nullptr;	// Reads sensors (see acquisitionTaskLoop()).
+TaskHandle_t processingTask = nullptr;	// Processes samples (see processingTaskLoop()).
 
 // ==========   SD card module   ==================== //
 SDCard sd;		// SDCard instance that exposes SD card routines. 
@@ -157,18 +173,25 @@ bool _isGood_GPS = false;
 
 // ==========   Async Web Server   ================== //
 AsyncWebServer server(80);	// Async web server instance on port 80.
+PageCache pageCache(LittleFS);	// Rendered pages, renewed after each sensor read.
+
+/*
+ Web handlers run in the AsyncTCP task, while the processing
+ task changes the SensorData instances. Handlers read current
+ values from the snapshot published after each sample, and copy
+ data series only between period processing, checked by
+ seriesVersion (see readPeriodData()).
+*/
+Seqlock<ReadingsSnapshot> currentReadings;	// Current values, for web pages.
+SeqCounter seriesVersion;		// Odd while period processing changes data series.
 
 // ==========   u-blox NEO-6M GPS   ========================== //
 // GPS module instance. 
 GPSModule gps;
 
-int _oldMonth = 0;		// Month of previous day.
-int _oldDay = 0;		// Day of previous day.
-int _oldYear = 0;		// Year of previous day.
-
 // ==========   PWM Fan for Radiation Shield  ======================== //
 
-volatile unsigned long _fanHalfRots = 0;// count fan half-rotation (2 counts/cycle)
+volatile unsigned long _fanHalfRots = 0;// count fan half-rotation (2 counts/cycle); never reset
 
 // HARDWARE INTERRUPT for fan tachometer switch that signals half-rotation
 portMUX_TYPE hardwareMux_fan = portMUX_INITIALIZER_UNLOCKED;
@@ -186,33 +209,45 @@ void IRAM_ATTR ISR_onFanHalfRotation() {
  Wind speed is determined by counting anemometer
  rotations over a brief base measurement period.
  Each rotation triggers a hardware interrupt that
- increments _anem_Rotations by 1.
+ increments _anem_Rotations by 1. The count is never
+ reset; the timer ISR queues it with each tick, and
+ TimerTicks gives the rotations between ticks.
 */
-volatile unsigned int _anem_Rotations = 0;		// Count of anemometer rotations
+volatile unsigned int _anem_Rotations = 0;		// Count of anemometer rotations since start
+// Time (micros) of every anemometer pulse, bounces included, 
+// for 3-s gusts. AnemometerPulses drops the bounces.
+SpscQueue<uint32_t, ANEM_PULSE_QUEUE_SIZE> anemPulses;	// ISR to acquisition task.
+AnemometerPulses anemometer(DAVIS_SPEED_CAL_FACTOR);	// Acquisition task.
 unsigned long _lastDebounceTime = 0;			// Last millis when output pin was toggled
 const unsigned int DEBOUNCE_TIMEOUT = 15;		// Debounce timeout (millisec)
 
 // TIMER INTERRUPT to count anemometer and fan rotations.
 hw_timer_t* timer_base = NULL;
-portMUX_TYPE timerMux_base = portMUX_INITIALIZER_UNLOCKED;
 
 /// <summary>
-/// Timer interrupt service routine to increment interrupt counts.
+/// Timer interrupt service routine to queue a tick with
+/// the anemometer and fan counts.
 /// </summary>
 void IRAM_ATTR ISR_onTimer_count() {
-	portENTER_CRITICAL_ISR(&timerMux_base);
-	_countInterrupts_base++;
-	_countInterrupts_10_min++;
-	_countInterrupts_60_min++;
-	portEXIT_CRITICAL_ISR(&timerMux_base);
+	timerTicks.onTimer(micros(), _anem_Rotations, _fanHalfRots);
+	// Wake acquisition task.
+	BaseType_t isHigherPriorityWoken = pdFALSE;
+	if (acquisitionTask != nullptr) {
+		vTaskNotifyGiveFromISR(acquisitionTask, &isHigherPriorityWoken);
+	}
+	if (isHigherPriorityWoken) {
+		portYIELD_FROM_ISR();
+	}
 }
 
 // HARDWARE INTERRUPT that signals one anemometer rotation.
 portMUX_TYPE hardwareMux_anem = portMUX_INITIALIZER_UNLOCKED;
 
 // Function called by hardware interrupt when anemometer sensor switch closes.
-// It increments the rotation count by 1, after switch debouncing.
+// It queues the pulse time, and increments the rotation count by 1, 
+// after switch debouncing.
 void IRAM_ATTR ISR_onRotation_anem() {
+	anemPulses.push(micros());
 	// Ignore any additional activations within the debounce time.
 	if ((millis() - _lastDebounceTime) > DEBOUNCE_TIMEOUT) {
 		portENTER_CRITICAL_ISR(&hardwareMux_anem);
@@ -223,102 +258,34 @@ void IRAM_ATTR ISR_onRotation_anem() {
 }
 // ========   END Davis Anemometer 6410  =================  //
 
-/// <summary>
-/// Check for too many (i.e., unhandled) timer interrupts 
-/// before reading and resetting rotation counts (for 
-/// anemometer, fan).
-/// </summary>
-void catchUnhandledBaseTimerInterrupts() {
-	// If base timer interrupt count exceeds 1, 
-	// the interrupt was unhandled. Can occur when
-	// loop processing time exceeds BASE_PERIOD_SEC.
-	if (_countInterrupts_base > 1) {	// Should be only 0 or 1.
-		String msg = "WARNING: Base timer interrupt count was ";
-		msg += String(_countInterrupts_base);
-		msg += " indicating unhandled timer interrupts. Reset to 0.";
-		sd.logStatus(msg, gps.dateTime());
-		portENTER_CRITICAL_ISR(&timerMux_base);
-		_countInterrupts_base = 0;	// Reset base timer interrupt.
-		portEXIT_CRITICAL_ISR(&timerMux_base);
-	}
-}
-
-/// <summary>
-/// Resets interrupt counters. Use when excessive time 
-/// in the main loop (such as WiFi reconnection after loss) 
-/// causes counts in interrupts to be unhandled.
-/// </summary>
-void resetInterruptCounts() {
-	String msg = "Skip read cycle where _countInterrupts_base was ";
-	msg += String(_countInterrupts_base);
-	sd.logStatus(msg, millis());
-
-	portENTER_CRITICAL_ISR(&timerMux_base);
-	_countInterrupts_base--;
-	portEXIT_CRITICAL_ISR(&timerMux_base);
-
-	portENTER_CRITICAL_ISR(&hardwareMux_fan);
-	_fanHalfRots = 0;		// Reset fan count.
-	portEXIT_CRITICAL_ISR(&hardwareMux_fan);
-
-	portENTER_CRITICAL_ISR(&hardwareMux_anem);
-	_anem_Rotations = 0;	// Reset anemometer count.
-	portEXIT_CRITICAL_ISR(&hardwareMux_anem);
-}
-
 /// <summary>
 /// Recover recent sensor readings from LittleFS.
 /// </summary>
 void recover_data() {
 	unsigned long lastTime = lastReadingTime_fromFile();
 	// 10-min lists
-	if (d_Temp_F.isDatafile()
-		&& (now() - lastTime) > DATA_RECOVERY_10_MIN_CUTOFF)
-	{
-		d_Temp_F.data_10_min_fromFile();
-
-
-		sd.logStatus("Recovered 10-min data.", millis());
-
-
+	if ((now() - lastTime) > DATA_RECOVERY_10_MIN_CUTOFF) {
+		unsigned int count = sensors.recover(PERIOD_10_MIN);
+		sd.logStatus("Recovered 10-min data for " + String(count) + " sensors.", millis());
 	}
 
 	// 60-min lists
-	if (d_Temp_F.isDatafile()
-		&& (now() - lastTime) > DATA_RECOVERY_60_MIN_CUTOFF)
-	{
-
-
-		d_Temp_F.data_60_min_fromFile();
-		sd.logStatus("Recovered 60-min data.", millis());
-
+	if ((now() - lastTime) > DATA_RECOVERY_60_MIN_CUTOFF) {
+		unsigned int count = sensors.recover(PERIOD_60_MIN);
+		sd.logStatus("Recovered 60-min data for " + String(count) + " sensors.", millis());
 	}
 
 	// day lists
-	if (d_Temp_F.isDatafile()
-		&& (now() - lastTime) > DATA_RECOVERY_DAY_CUTOFF)
-	{
-		d_Temp_F.data_dayMaxMin_fromFile();
-		sd.logStatus("Recovered dayMaxMin data.", millis());
+	if ((now() - lastTime) > DATA_RECOVERY_DAY_CUTOFF) {
+		unsigned int count = sensors.recover(PERIOD_DAY);
+		sd.logStatus("Recovered dayMaxMin data for " + String(count) + " sensors.", millis());
 	}
-}
 
-
-
-///
-//void recoverData_forSensors(list<SensorData>& sensors, dataPeriod period) {
-//
-//	for (list<SensorData>::iterator it = sensors.begin(); it != sensors.end(); ++it) {
-//		SensorData sen = *it;
-//		if (sen.isDatafile())
-//		{
-//			sen.recover_data_fromFile(PERIOD_10_MIN);
-//			//sen.data_10_min_fromFile();
-//			String msg = "Recovered " + sen.label() + String(dataPeriodName[period]) + " data.";
-//			sd.logStatus(msg, millis());
-//		}
-//	}
-//}
+	// Wind rose has its own same-day check.
+	if (windDir.recoverRose(now())) {
+		sd.logStatus("Recovered today's wind rose.", millis());
+	}
+}
 
 /****************************************************************************/
 /******************************      SETUP      *****************************/
@@ -337,6 +304,7 @@ void setup() {
 	//  ==========  CREATE SD CARD   ========== //
 	// (Do this first - need SD card for logging.)
 	_isGood_SDCard = sd.create(SPI_CS_PIN, _isDEBUG_BypassSDCard);
+	sd.setPhaseTimer(&phaseTimer);
 	// Begin status log entries to SD card.
 	sd.logStatus();	// Empty line
 	sd.logStatus(LINE_SEPARATOR_MAJOR);
@@ -388,16 +356,15 @@ void setup() {
 
 	// ==========  CREATE SENSORS  ========== //
 
-	sensors_AddLabels();	// Add labels and units to the SensorData instances.
+	sensors_register();		// Add labels and units, and register the SensorData instances.
 	sensors_begin();
+	sensors_schedule();		// Spread slow sensor reads over base periods.
 	sensors_createFiles();
 	// Retrieve recent saved data from LittleFS.
 	recover_data();
 
 	// Date info to determine when new day begins.
-	_oldDay = day();
-	_oldMonth = month();
-	_oldYear = year();
+	timerTicks.startDay();
 
 //#if defined(VM_DEBUG)
 	////////  TESTING   ////////
@@ -409,6 +376,7 @@ void setup() {
 		Serial.println();
 	}
 	if (_isDEBUG_run_test_in_setup) {
+		test.benchmarkRingBuffer(20000);	// Before test code, which does not return.
 		test.testCodeForSetup3(true);
 	}
 //#endif
@@ -439,13 +407,23 @@ void setup() {
 	pinMode(FAN_SPEED_PIN, INPUT_PULLUP);
 	attachInterrupt(digitalPinToInterrupt(FAN_SPEED_PIN), ISR_onFanHalfRotation, FALLING);
 
+	// ==========  CREATE ACQUISITION AND PROCESSING TASKS  ========== //
+	// Processing first, as acquisition wakes it.
+	if (xTaskCreatePinnedToCore(processingTaskLoop, "Processing", PROCESSING_TASK_STACK,
+		nullptr, PROCESSING_TASK_PRIORITY, &processingTask, PROCESSING_TASK_CORE) != pdPASS
+		|| xTaskCreatePinnedToCore(acquisitionTaskLoop, "Acquisition", ACQUISITION_TASK_STACK,
+		nullptr, ACQUISITION_TASK_PRIORITY, &acquisitionTask, ACQUISITION_TASK_CORE) != pdPASS) {
+		sd.logStatus("ERROR: Acquisition or processing task could not be created.", millis());
+	}
+
 	// ==========  CREATE TIMER INTERRUPT  ========== //
 	/*
 	 Timer interrupt fires every BASE_PERIOD_SEC to
-	 trigger counts of anemometer and fan rotations.
-	 This is ALSO when we record all the other sensor readings.
-	 ONLY WIND SPEED NEEDS TO BE RECORDED THIS FREQUENTLY.
-	 [NOTE: Consider spacing out the other sensor readings.]
+	 trigger counts of anemometer and fan rotations,
+	 and wakes the acquisition task to read them.
+	 Other sensors are read on the ticks that sensorSchedule
+	 gives them (see sensors_schedule()), as only wind speed 
+	 needs to be recorded this frequently.
 	*/
 	timer_base = timerBegin(0, 80, true);
 	timerAttachInterrupt(timer_base, &ISR_onTimer_count, true);
@@ -457,6 +435,7 @@ void setup() {
 	(IS_DAYLIGHT_TIME) ? msg = " Daylight time." : msg = " Standard time.";
 	sd.logStatus(msg);
 	sd.logStatus("SETUP END " + gps.dateTime(), millis());
+	sd.flush();		// Write setup log now, rather than when flush task wakes.
 	}
 /****************************************************************************/
 /************************        END SETUP       ****************************/
@@ -466,110 +445,202 @@ void setup() {
 /***************************       LOOP      ********************************/
 /****************************************************************************/
 void loop() {
-	_timeStart_Loop = millis();	// To monitor loop execution time.
+	/// ==========  TEST FOR LOST WIFI CONNECTION  ========== //
+	/*
+	If WiFi is lost, take the time to reconnect here.
+	Sensors are still read by the acquisition task, and
+	samples wait in sampleQueue for the processing task.
+	*/
+	if (!_isDEBUG_BypassWifi) {
+		if (WiFi.status() != WL_CONNECTED) {
+			unsigned long timeStart = PhaseTimer::start();
+			checkWifiConnection();
+			phaseTimer.stop(PHASE_WIFI_CHECK, timeStart);
+		}
+	}
+
+//#if defined(VM_DEBUG)
+	// Add delay for DEBUG.
+	if (_isDEBUG_AddDelayInLoop) {
+		vTaskDelay(_LOOP_DELAY_DEBUG_ms / portTICK_PERIOD_MS);
+	}
+//#endif
+
+	vTaskDelay(WIFI_CHECK_PERIOD_MS / portTICK_PERIOD_MS);
+}
+/******************************        END LOOP        **********************************/
+/****************************************************************************************/
+/****************************************************************************************/
 
-	// Check for timer interrupts that were 
-	// not handled during code delays.
-	catchUnhandledBaseTimerInterrupts();
+/****************************************************************************/
+/*****************    ACQUISITION AND PROCESSING TASKS    *******************/
+/****************************************************************************/
 
-	/************************************************
-		Read sensors and process data at intervals
-		determined from timer interrupt.
-	*************************************************/
+/// <summary>
+/// Acquisition task: reads sensors each time the base timer wakes it.
+/// </summary>
+void acquisitionTaskLoop(void* param) {
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);	// Woken by ISR_onTimer_count().
+		// Take every tick queued, in order, even if some are late.
+		TimerTicks::Tick tick;
+		while (timerTicks.take(tick)) {
+			acquireSample(tick);
+		}
+	}
+}
+
+/// <summary>
+/// Reads the sensors due on a base period, flags the periods 
+/// that end with it, and queues the sample for processing.
+/// </summary>
+/// <param name="tick">Base period, from timerTicks.</param>
+void acquireSample(const TimerTicks::Tick& tick) {
+	unsigned long timeStart_ms = millis();
+	unsigned long timeStart = PhaseTimer::start();
+	// Ticks are lost only if acquisition falls TICK_QUEUE_SIZE behind.
+	if (tick.periods > 1) {
+		String msg = "WARNING: " + String(tick.periods - 1);
+		msg += " base timer ticks lost; their counts are averaged into the next.";
+		sd.logStatus(msg, gps.dateTime());
+	}
+
+	TickSample sample;
+	// Time of the interrupt, which is earlier if the tick waited.
+	sample.time = now() - (micros() - tick.time_us) / MICROSEC_PER_SECOND;
 
 	//  ====================================================
-	//   BASE_PERIOD_SEC. Every timer interrupt.
-	if (_countInterrupts_base == 1) {
-		// Read sensors and process data.
-		readWind();
-		readFan();
-		// Read data for other sensors.
-		readSensors();
-		portENTER_CRITICAL_ISR(&timerMux_base);
-		_countInterrupts_base--;	// Base timer interrupt handled.
-		portEXIT_CRITICAL_ISR(&timerMux_base);
+	//   BASE_PERIOD_SEC. Every timer tick.
+	sample.flags |= TickSample::SAMPLE_READ;
+	unsigned long timeStartRead = PhaseTimer::start();
+	sample.anemRotations = tick.anemRotations / tick.periods;
+	readWind(sample);
+	phaseTimer.stop(PHASE_WIND, timeStartRead);
+	timeStartRead = PhaseTimer::start();
+	readFan(sample, tick.fanHalfRots, tick.periods);
+	phaseTimer.stop(PHASE_FAN, timeStartRead);
+	// Read data for other sensors due on this tick.
+	sensorSchedule.tick(sample, &phaseTimer);
+
+	//   ====================================================
+	//    10-MIN AND 60-MIN INTERVALS.
+	if (tick.is_10_min) {
+		sample.flags |= TickSample::SAMPLE_10_MIN;
+	}
+	if (tick.is_60_min) {
+		sample.flags |= TickSample::SAMPLE_60_MIN;
+	}
+
+	// ====================================================
+	//  CHECK FOR NEW DAY
+	if (timerTicks.takeNewDay()) {
+		sample.flags |= TickSample::SAMPLE_NEW_DAY;
+	}
+
+	if (!sampleQueue.push(sample)) {
+		String msg = "WARNING: Sample queue full; readings dropped (";
+		msg += String(sampleQueue.dropped()) + " samples in all).";
+		sd.logStatus(msg, gps.dateTime());
+	}
+	xTaskNotifyGive(processingTask);
+	phaseTimer.stop(PHASE_ACQUISITION, timeStart);
+
+	// Watch for excessive acquisition time.
+	if (millis() - timeStart_ms > LOOP_TIME_WARNING_THRESHOLD_MS) {
+		String msg = "WARNING: Acquisition " + String(millis() - timeStart_ms) + "ms";
+		sd.logStatus(msg, gps.dateTime());
+	}
+}
+
+/// <summary>
+/// Processing task: processes queued samples, in order, 
+/// each time the acquisition task wakes it.
+/// </summary>
+void processingTaskLoop(void* param) {
+	TickSample sample;
+	for (;;) {
+		ulTaskNotifyTake(pdTRUE, portMAX_DELAY);	// Woken by acquireSample().
+		while (sampleQueue.pop(sample)) {
+			processSample(sample);
+		}
+	}
+}
+
+/// <summary>
+/// Adds a sample's readings to the SensorData lists, and
+/// processes the periods that end with it.
+/// </summary>
+void processSample(const TickSample& sample) {
+	unsigned long timeStart_ms = millis();
+	unsigned long timeStart = PhaseTimer::start();
+
+	if (sample.has(TickSample::SAMPLE_READ)) {
+		applySample(sample);
+	}
+
+	// Period processing changes the series that data routes send.
+	bool isPeriodEnd = sample.has(TickSample::SAMPLE_10_MIN)
+		|| sample.has(TickSample::SAMPLE_60_MIN)
+		|| sample.has(TickSample::SAMPLE_NEW_DAY);
+	if (isPeriodEnd) {
+		seriesVersion.beginWrite();
 	}
 
 	//   ====================================================
 	//    10-MIN INTERVAL.
-	if (_countInterrupts_10_min >= BASE_PERIODS_IN_10_MIN) {
+	if (sample.has(TickSample::SAMPLE_10_MIN)) {
 		// Get 10-min avgs.
+		unsigned long timeStartPeriod = PhaseTimer::start();
 		processReadings_10_min();
 		sd.logData(sensorsDataString_10_min());	// Save readings to SD card.
+		phaseTimer.stop(PHASE_10_MIN, timeStartPeriod);
 		sd.logStatus("Logged 10-min avgs.", gps.dateTime());
-		// Check for unhandled interrupts.
-		if (_countInterrupts_10_min > BASE_PERIODS_IN_10_MIN)
-		{
-			String msg = "WARNING: 10-min interrupt count exceeded threshold by ";
-			msg += String(_countInterrupts_base - BASE_PERIODS_IN_10_MIN);
-			msg += " indicating unhandled 10-min timer interrupt.";
-			sd.logStatus(msg, gps.dateTime());
-		}
-		portENTER_CRITICAL_ISR(&timerMux_base);
-		_countInterrupts_10_min = 0;	// Interrupt handled.
-		portEXIT_CRITICAL_ISR(&timerMux_base);
 	}
 
 	//   ====================================================
 	//    60-MIN INTERVAL
-	if (_countInterrupts_60_min >= BASE_PERIODS_IN_60_MIN) {
+	if (sample.has(TickSample::SAMPLE_60_MIN)) {
+		unsigned long timeStartPeriod = PhaseTimer::start();
 		processReadings_60_min();
 		sd.logData(sensorsDataString_10_min());	// Save readings to SD card.
+		phaseTimer.stop(PHASE_60_MIN, timeStartPeriod);
 		sd.logStatus("Logged 60-min avgs.", gps.dateTime());
-		// Check for unhandled.
-		if (_countInterrupts_60_min > BASE_PERIODS_IN_60_MIN) {
-			String msg = "WARNING: 10-min interrupt count exceeded threshold by ";
-			msg += String(_countInterrupts_60_min - BASE_PERIODS_IN_60_MIN);
-			msg += " counts, indicating unhandled 10-min timer interrupt.";
-			sd.logStatus(msg, gps.dateTime());
+		// Log the hour's phase timings, and start a new hour.
+		sd.logStatus("Task phase timing (us) for last hour:", gps.dateTime());
+		String report = phaseTimer.report();
+		for (int i = 0, j; (j = report.indexOf('\n', i)) >= 0; i = j + 1) {
+			sd.logStatus_indent(report.substring(i, j));
 		}
-		portENTER_CRITICAL_ISR(&timerMux_base);
-		_countInterrupts_60_min--;	// Interrupt handled.
-		portEXIT_CRITICAL_ISR(&timerMux_base);
+		phaseTimer.clear();
 	}
 
 	// ====================================================
-	//  CHECK FOR NEW DAY
-	if (day() > _oldDay || month() > _oldMonth || year() > _oldYear) {
-		// NEW DAY. 
+	//  NEW DAY
+	if (sample.has(TickSample::SAMPLE_NEW_DAY)) {
 		// Save minima and maxima for previous day.
+		unsigned long timeStartPeriod = PhaseTimer::start();
 		processReadings_day();
-		_oldDay = day();
-		_oldMonth = month();
-		_oldYear = year();
+		phaseTimer.stop(PHASE_DAY, timeStartPeriod);
 		sd.logStatus("New day rollover.", gps.dateTime());
 	}
 
-	/// ==========  TEST FOR LOST WIFI CONNECTION  ========== //
-	/*
-	If WiFi is lost, we're screwed because the time
-	to reconnect may throw of the sensor read timings.
-	Just bite the bullet and take the time to reconnect,
-	then recover.
-
-	If WiFi was lost, the time to reconnect will cause
-	the timer interrupt counts to increment beyond where
-	they should have been handled.
-	*/
-	if (!_isDEBUG_BypassWifi) {
-		if (WiFi.status() != WL_CONNECTED) {
-			checkWifiConnection();
-		}
+	if (isPeriodEnd) {
+		seriesVersion.endWrite();
 	}
 
-//#if defined(VM_DEBUG)
-	// Add delay for DEBUG.
-	if (_isDEBUG_AddDelayInLoop) {
-		vTaskDelay(_LOOP_DELAY_DEBUG_ms / portTICK_PERIOD_MS);
+	// Publish current values for web handlers.
+	if (sample.has(TickSample::SAMPLE_READ) || isPeriodEnd) {
+		ReadingsSnapshot snapshot;
+		snapshot.take(sensors, windDir, sample.time);
+		currentReadings.write(snapshot);
+		pageCache.invalidate();		// Pages now show old readings.
 	}
-//#endif
 
-	// Watch for excessive processing time in loop.
-	if (millis() - _timeStart_Loop > LOOP_TIME_WARNING_THRESHOLD_MS) {
-		String msg = "WARNING: Loop " + String(millis() - _timeStart_Loop) + "ms";
+	phaseTimer.stop(PHASE_PROCESSING, timeStart);
+
+	// Watch for excessive processing time.
+	if (millis() - timeStart_ms > LOOP_TIME_WARNING_THRESHOLD_MS) {
+		String msg = "WARNING: Processing " + String(millis() - timeStart_ms) + "ms";
 		sd.logStatus(msg, gps.dateTime());
 	}
 }
-/******************************        END LOOP        **********************************/
-/****************************************************************************************/
-/****************************************************************************************/
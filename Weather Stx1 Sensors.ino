@@ -6,6 +6,9 @@ WindSpeed windSpeed(
 	WIND_SPEED_NUMBER_IN_MOVING_AVG,
 	WIND_SPEED_OUTLIER_DELTA);	// WindSpeed instance for wind.
 SensorData windGust;
+SensorData windSustained(true, false, false);	// 2-min average (NWS "wind speed").
+SensorData windPeak(true, false, false);		// Peak wind, above PEAK_WIND_THRESHOLD.
+WindAggregator windAggregator;		// Sustained wind, gusts and peak wind.
 WindDirection windDir(VANE_OFFSET);	// WindDirection instance for wind.
 
 
@@ -32,6 +35,15 @@ Adafruit_BME280 sensor_PRH; // BME280 temperature sensor.
 OneWire oneWire(ONE_WIRE_PIN);
 // Pass our oneWire reference to Dallas Temperature sensor.
 DallasTemperature sensor_T(&oneWire);
+/*
+ Conversions are not waited for (setWaitForConversion(false)).
+ requestTemp_DS18B20() starts one on one tick, and
+ readTemp_DS18B20() collects the result on a later tick,
+ instead of loop() blocking ~750 ms for a 12-bit conversion.
+*/
+bool _isTempRequested = false;			// DS18B20 conversion started and not collected.
+unsigned long _timeTempRequested = 0;	// millis() when conversion started.
+unsigned long _tempWait_ms = 750;		// Conversion time at the resolution read in sensors_begin().
 
 // 1-Wire routines  ///////////////////////////
 
@@ -51,13 +63,21 @@ int countOneWireDevices() {
 }
 
 /// <summary>
-/// Returns temperature (F) from DS18B20 sensor.
+/// Starts a DS18B20 temperature conversion, and returns 
+/// without waiting for it.
 /// </summary>
-/// <returns></returns>
-float reading_Temp_F_DS18B20() {
+void requestTemp_DS18B20(TickSample& sample) {
 	sensor_T.requestTemperatures();	// Begin DS18B20 sensor read.
-	float temp = sensor_T.getTempFByIndex(0);	// Retrieve reading
-	return temp;
+	_timeTempRequested = millis();
+	_isTempRequested = true;
+}
+
+/// <summary>
+/// Returns true if a requested DS18B20 conversion has 
+/// had time to finish.
+/// </summary>
+bool isTempReady_DS18B20() {
+	return _isTempRequested && millis() - _timeTempRequested >= _tempWait_ms;
 }
 
 /// <summary>
@@ -93,6 +113,7 @@ void sensors_begin() {
 	}
 	//  ---------------  DS18B20 T sensor   ---------------
 	sensor_T.begin();
+	sensor_T.setWaitForConversion(false);	// See requestTemp_DS18B20().
 	// Find DS18B20 temperature.
 	if (countOneWireDevices() < 1) {
 		_isGood_Temp = false;
@@ -101,6 +122,8 @@ void sensors_begin() {
 	}
 	else {
 		_isGood_Temp = true;
+		// Resolution is a scratchpad read, so read it once here.
+		_tempWait_ms = sensor_T.millisToWaitForConversion(sensor_T.getResolution());
 		String msg = "DS18B20 T sensor found.";
 		sd.logStatus(msg, millis());
 	}
@@ -163,33 +186,55 @@ void sensors_begin() {
 /******   WIND READINGS    ******/
 
 /// <summry>
-/// Reads and saves wind speed, gusts, and direction.
+/// Reads wind direction, the peak 3-s speed and the speed
+/// of the last rotation into a sample, which holds the
+/// tick's anemometer rotations. Acquisition task.
 /// </summary>
-void readWind() {
+void readWind(TickSample& sample) {
 	if (_isDEBUG_simulateWindReadings) {
-		readWind_Simulate();
+		readWind_Simulate(sample);
 		return;
 	}
-	// Read wind speed.
-	float speed = windSpeed.speedInstant(_anem_Rotations, BASE_PERIOD_SEC);
-	dataPoint dpSpeed(now(), speed);
-	windSpeed.addReading(dataPoint(dpSpeed));
-
-	// Record any gusts.
-	float avg = windSpeed.avg_now();
-	dataPoint dpGust = windSpeed.gust(dpSpeed, avg);
-	windGust.addReading(dpGust);
-
-
+	// Peak 3-s speed from pulse times queued by ISR_onRotation_anem().
+	const unsigned int BATCH_SIZE = 64;
+	uint32_t times[BATCH_SIZE];
+	unsigned int count;
+	do {
+		for (count = 0; count < BATCH_SIZE && anemPulses.pop(times[count]); count++) {}
+		anemometer.add(times, count);
+	} while (count == BATCH_SIZE);
+	sample.gust_3s = anemometer.takePeak();
+
+	// Read wind direction, with the speed at that moment.
+	sample.windAngle = windAngleReading();
+	sample.speed_now = anemometer.speedInstant(micros());
+}
 
-	// Read wind direction.
-	float windAngle = windAngleReading();
-	windDir.addReading(now(), windAngle, speed);	// weighted by speed
+/// <summary>
+/// Adds a sample's wind speed, gusts, and direction, and its
+/// other readings, to the SensorData lists. Processing task.
+/// </summary>
+void applySample(const TickSample& sample) {
+	// Wind speed.
+	float speed = windSpeed.speedInstant(sample.anemRotations, BASE_PERIOD_SEC);
+	dataPoint dpSpeed(sample.time, speed);
+	windSpeed.addReading(dpSpeed);
 
-	// Reset hardware interrupt count.
-	portENTER_CRITICAL_ISR(&hardwareMux_anem);
-	_anem_Rotations = 0;	// Reset anemometer count.
-	portEXIT_CRITICAL_ISR(&hardwareMux_anem);
+	// Sustained wind, gust (10-min peak vs lull) and peak wind.
+	// Peak 3-s speed from timed pulses, if any, else the period's speed.
+	float peak = (sample.gust_3s > 0) ? sample.gust_3s : speed;
+	windAggregator.add(speed, peak);
+	windSustained.addReading(dataPoint(sample.time, windAggregator.sustained()));
+	windGust.addReading(dataPoint(sample.time, windAggregator.gust()));
+	windPeak.addReading(dataPoint(sample.time, windAggregator.peakWind()));
+
+	// Wind direction, weighted by the speed when the vane was
+	// read, if pulses were timed, else the period's speed.
+	float speedAtVane = (sample.speed_now >= 0) ? sample.speed_now : speed;
+	windDir.addReading(sample.time, sample.windAngle, speedAtVane);
+
+	// Other sensors.
+	sample.apply();
 }
 
 /// <summary>
@@ -214,14 +259,14 @@ int windAngleReading() {
 }
 
 /// <summary>
-/// Adds simulated wind speed readings.
+/// Adds simulated anemometer rotations and wind direction to a sample.
 /// </summary>
-void readWind_Simulate() {
+void readWind_Simulate(TickSample& sample) {
 #if defined(VM_DEBUG)
 	float sim_speed_start = 3;
 	float sim_speed_spike = 15;
 	float sim_speed_incr = 0.025;
-	unsigned int rots = dummy_anemCount.linear
+	sample.anemRotations = dummy_anemCount.linear
 	(
 		rotsFromSpeed(sim_speed_start),
 		rotsFromSpeed(sim_speed_incr),
@@ -229,119 +274,122 @@ void readWind_Simulate() {
 		50,
 		6
 	);
-	float speed = windSpeed.speedInstant(rots, BASE_PERIOD_SEC);
-	dataPoint dpSpeed(now(), speed);
-	windSpeed.addReading(dpSpeed);
-
-	// XXX  DOES THIS WORK FOR SIMULATION?!?!  XXX
-	// Record any gusts. Use MOVING AVG of wind speed.
-	float avg_moving = windSpeed.avgMoving();
-	dataPoint dpGust = windSpeed.gust(dpSpeed, avg_moving);
-	windGust.addReading(dpGust);
-
-	// Read wind direction.
-	float windAngle = dummy_windDir.sawtooth(90, 1, 360);
-	windDir.addReading(now(), windAngle, dpSpeed.value);	// weighted by speed
+	sample.windAngle = dummy_windDir.sawtooth(90, 1, 360);
 #endif
 }
 
 
 /// <summary>
-/// Reads and saves fan speed.
+/// Adds fan speed to a sample.
 /// </summary>
-void readFan() {
-	// Get fan speed.
-	d_fanRPM.addReading(dataPoint(now(), fanRPM(_fanHalfRots, BASE_PERIOD_SEC)));
-	// Reset hardware interrupt count.
-	portENTER_CRITICAL(&hardwareMux_fan);
-	_fanHalfRots = 0;		// Reset fan rotations.		
-	portEXIT_CRITICAL(&hardwareMux_fan);
+/// <param name="halfRots">Fan half-rotations counted.</param>
+/// <param name="periods">Base periods over which they were counted.</param>
+void readFan(TickSample& sample, unsigned long halfRots, unsigned int periods) {
+	sample.add(d_fanRPM, fanRPM(halfRots, BASE_PERIOD_SEC * periods));
 }
 
 /// <summary>
-/// Reads and saves data from sensors.
+/// Schedules sensor reads. Wind and fan are read every base
+/// period in acquireSample(). The slow one-wire and I2C sensors are read
+/// every SENSOR_READ_PERIOD base periods, each on a different
+/// tick, so no tick waits on all of them.
 /// </summary>
-void readSensors() {
-	unsigned long timeStart = millis();
+void sensors_schedule() {
 	if (_isDEBUG_simulateSensorReadings) {
-		// Simulate sensor readings.
-		readSensors_Simulate();
-		return;
+		sensorSchedule.add("Simulated", readSensors_Simulate, 1, 0);
 	}
-	dataPoint dp;	// holds successive readings
-	// Temperature.
-	dp = dataPoint(now(), reading_Temp_F_DS18B20());
-	d_Temp_F.addReading(dp);
-	// UV readings.
-	dp = dataPoint(now(), sensor_UV.uva());
-	d_UVA.addReading(dp);
-	dp = dataPoint(now(), sensor_UV.uvb());
-	d_UVB.addReading(dp);
-	dp = dataPoint(now(), sensor_UV.index());
-	d_UVIndex.addReading(dp);
-	// P, RH
-	dp = dataPoint(now(), sensor_PRH.readHumidity());
-	d_RH.addReading(dp);
-	dp = dataPoint(now(), sensor_PRH.readPressure() / 100);
-	d_Pres_mb.addReading(dp);			// Raw pressure in mb (hectopascals)
-	dp = dataPoint(now(), sensor_PRH.readTemperature());
-	d_Temp_for_RH_C.addReading(dp);		// Temp (C) of P, RH sensor.
+	else {
+		// Name, read function, period, phase, timed phase.
+		// DS18B20 conversion is started the tick before it is read.
+		sensorSchedule.add("DS18B20 request",	requestTemp_DS18B20,	SENSOR_READ_PERIOD,	SENSOR_READ_PERIOD - 1);
+		sensorSchedule.add("DS18B20",	readTemp_DS18B20,	SENSOR_READ_PERIOD,	0,	PHASE_TEMP_DS18B20);
+		sensorSchedule.add("BME280",	readPRH_BME280,		SENSOR_READ_PERIOD,	1,	PHASE_PRH_BME280);
+		sensorSchedule.add("VEML6075",	readUV_VEML6075,	SENSOR_READ_PERIOD,	2,	PHASE_UV_VEML6075);
+		sensorSchedule.add("MLX90614",	readIR_MLX90614,	SENSOR_READ_PERIOD,	3,	PHASE_IR_MLX90614);
+		sensorSchedule.add("Insolation",	readInsol,		1,					0,	PHASE_INSOLATION);
+	}
+	String msg = "Sensor reads scheduled: " + String(sensorSchedule.count());
+	msg += ", at most " + String(sensorSchedule.maxDue()) + " per base period.";
+	sd.logStatus(msg, millis());
+}
+
+/// <summary>
+/// Reads temperature from the conversion started by 
+/// requestTemp_DS18B20() into a sample, if it has finished.
+/// </summary>
+void readTemp_DS18B20(TickSample& sample) {
+	if (!isTempReady_DS18B20()) {
+		return;		// None requested yet (first tick), or not finished.
+	}
+	_isTempRequested = false;
+	sample.add(d_Temp_F, sensor_T.getTempFByIndex(0));	// Retrieve reading
+}
+
+/// <summary>
+/// Reads UV readings into a sample.
+/// </summary>
+void readUV_VEML6075(TickSample& sample) {
+	sample.add(d_UVA, sensor_UV.uva());
+	sample.add(d_UVB, sensor_UV.uvb());
+	sample.add(d_UVIndex, sensor_UV.index());
+}
+
+/// <summary>
+/// Reads pressure and relative humidity, and pressure 
+/// adjusted to sea level, into a sample.
+/// </summary>
+void readPRH_BME280(TickSample& sample) {
+	float pres_mb = sensor_PRH.readPressure() / 100;	// Raw pressure in mb (hectopascals)
+	float temp_C = sensor_PRH.readTemperature();		// Temp (C) of P, RH sensor.
+	sample.add(d_RH, sensor_PRH.readHumidity());
+	sample.add(d_Pres_mb, pres_mb);
+	sample.add(d_Temp_for_RH_C, temp_C);
 	// P adjusted to sea level.
-	float psl = pressureAtSeaLevel(
-		d_Pres_mb.valueLastAdded(),
-		gps.data.altitude(),
-		d_Temp_for_RH_C.valueLastAdded());
-	dp = dataPoint(now(), psl);
-	d_Pres_seaLvl_mb.addReading(dp);
-	// IR sky
-	dp = dataPoint(now(), sensor_IR.readObjectTempC());
-	d_IRSky_C.addReading(dp);
-	// Insolation/
-	float insol_norm = insol_norm_pct(readInsol_mV(), INSOL_REFERENCE_MAX);
-	dp = dataPoint(now(), insol_norm);
-	d_Insol.addReading(dp);	// % Insolation
+	sample.add(d_Pres_seaLvl_mb, pressureAtSeaLevel(pres_mb, gps.data.altitude(), temp_C));
+}
+
+/// <summary>
+/// Reads IR sky temperature into a sample.
+/// </summary>
+void readIR_MLX90614(TickSample& sample) {
+	sample.add(d_IRSky_C, sensor_IR.readObjectTempC());
+}
 
-	unsigned int timeEnd = millis() - timeStart;
+/// <summary>
+/// Reads insolation into a sample.
+/// </summary>
+void readInsol(TickSample& sample) {
+	float insol_norm = insol_norm_pct(readInsol_mV(), INSOL_REFERENCE_MAX);
+	sample.add(d_Insol, insol_norm);	// % Insolation
 }
 
 /// <summary>
-/// Adds simulated values to sensor readings 
+/// Adds simulated values of sensor readings to a sample
 /// (doesn't include wind readings).
 /// </summary>
-void readSensors_Simulate() {
+void readSensors_Simulate(TickSample& sample) {
 #if defined(VM_DEBUG)
-	dataPoint dp;	// holds reading
 	// Temperature.
-	dp = dataPoint(now(), dummy_Temp_F.sawtooth(10, 0.02, 20));
-	d_Temp_F.addReading(dp);
+	sample.add(d_Temp_F, dummy_Temp_F.sawtooth(10, 0.02, 20));
 	// UV readings.
-	/*dp = dataPoint(now(), dummy_UVA.linear(3, 0.1));
-	d_UVA.addReading(dp);
-	dp = dataPoint(now(), dummy_UVB.linear(3, 0.1));
-	d_UVB.addReading(dp);*/
-	dp = dataPoint(now(), dummy_UVIndex.sawtooth(0, 0.05, 10));
-	d_UVIndex.addReading(dp);
+	/*sample.add(d_UVA, dummy_UVA.linear(3, 0.1));
+	sample.add(d_UVB, dummy_UVB.linear(3, 0.1));*/
+	sample.add(d_UVIndex, dummy_UVIndex.sawtooth(0, 0.05, 10));
 	// P, RH
-	dp = dataPoint(now(), dummy_RH.sawtooth(0, 0.05, 50));
-	d_RH.addReading(dp);
-	dp = dataPoint(now(), dummy_Pres_mb.linear(3, 0.1) / 100);
-	d_Pres_mb.addReading(dp);			// Raw pressure in mb (hectopascals)
-	//dp = dataPoint(now(), dummy_Temp_for_RH_C.linear(10, 0.02));
-	//d_Temp_for_RH_C.addReading(dp);		// Temp (C) of P, RH sensor.
+	sample.add(d_RH, dummy_RH.sawtooth(0, 0.05, 50));
+	sample.add(d_Pres_mb, dummy_Pres_mb.linear(3, 0.1) / 100);	// Raw pressure in mb (hectopascals)
+	//sample.add(d_Temp_for_RH_C, dummy_Temp_for_RH_C.linear(10, 0.02));	// Temp (C) of P, RH sensor.
 	// P adjusted to sea level.
 	float psl = pressureAtSeaLevel(
 		dummy_Pres_seaLvl_mb.linear(950, 0.01),
 		gps.data.altitude(),
 		25);
-	dp = dataPoint(now(), psl);
-	d_Pres_seaLvl_mb.addReading(dp);
+	sample.add(d_Pres_seaLvl_mb, psl);
 	// IR sky
-	dp = dataPoint(now(), dummy_IRSky_C.sawtooth(10, 0.02, 20));	// .sawtooth(0, 0.02, 10));
-	d_IRSky_C.addReading(dp);
+	sample.add(d_IRSky_C, dummy_IRSky_C.sawtooth(10, 0.02, 20));	// .sawtooth(0, 0.02, 10));
 	// Insolation/
 	float insol_norm = insol_norm_pct(dummy_Insol.linear(0, 0.01), INSOL_REFERENCE_MAX);
-	dp = dataPoint(now(), insol_norm);
-	d_Insol.addReading(dp);	// % Insolation
+	sample.add(d_Insol, insol_norm);	// % Insolation
 #endif
 }
 
@@ -364,7 +412,9 @@ unsigned long lastReadingTime_fromFile()
 {
 	// Read from LittleFS
 	//if (_isDatafile) {
-	return fileRead(LittleFS, SENSOR_DATA_TIME_FILE_PATH.c_str()).toInt();
+	char timeC[16];
+	fileReadInto(LittleFS, SENSOR_DATA_TIME_FILE_PATH.c_str(), timeC, sizeof(timeC));
+	return strtoul(timeC, nullptr, 10);
 	//}
 	//else {
 	//	return 0;
@@ -400,19 +450,7 @@ unsigned long lastReadingTime_fromFile()
 /// to lists.
 /// </summary>
 void processReadings_10_min() {
-	windSpeed.process_data_10_min();
-	windGust.process_data_10_min();
-	windDir.process_data_10_min();
-	d_Temp_F.process_data_10_min();
-	d_Pres_mb.process_data_10_min();		// Just save avg_10?
-	d_Pres_seaLvl_mb.process_data_10_min();
-	d_Temp_for_RH_C.process_data_10_min();	// Just save avg_10?
-	d_RH.process_data_10_min();
-	d_UVA.process_data_10_min();
-	d_UVB.process_data_10_min();
-	d_UVIndex.process_data_10_min();
-	d_Insol.process_data_10_min();
-	d_IRSky_C.process_data_10_min();
+	sensors.process(PERIOD_10_MIN);
 	// Save last 10-min reading t to LittleFS. Used 
 	// to check whether to recover data at reboot.
 	saveLastReadTime_toFile(now());
@@ -422,33 +460,14 @@ void processReadings_10_min() {
 /// Saves 60-min averages to lists.
 /// </summary>
 void processReadings_60_min() {
-	windSpeed.process_data_60_min();
-	windGust.process_data_60_min();
-	windDir.process_data_60_min();
-	d_Temp_F.process_data_60_min();
-	d_Pres_seaLvl_mb.process_data_60_min();
-	d_RH.process_data_60_min();
-	d_UVA.process_data_60_min();
-	d_UVB.process_data_60_min();
-	d_UVIndex.process_data_60_min();
-	d_Insol.process_data_60_min();
-	d_IRSky_C.process_data_60_min();
+	sensors.process(PERIOD_60_MIN);
 }
 /// <summary>
 /// Saves all readings minima and maxima 
 /// for the prior day.
 /// </summary>
 void processReadings_day() {
-	windSpeed.process_data_day();
-	windDir.process_data_day();
-	d_Temp_F.process_data_day();
-	d_Pres_seaLvl_mb.process_data_day();
-	d_RH.process_data_day();
-	d_UVA.process_data_day();
-	d_UVB.process_data_day();
-	d_UVIndex.process_data_day();
-	d_Insol.process_data_day();
-	d_IRSky_C.process_data_day();
+	sensors.process(PERIOD_DAY);
 }
 
 /*******  DUMMY DATA   ********/
@@ -518,45 +537,52 @@ void addDummyData() {
 }
 
 /// <summary>
-/// Adds labels and units to SensorData instances.
+/// Adds labels and units to SensorData instances and 
+/// registers them, in processing order, with what is 
+/// done with each one.
 /// </summary>
-void sensors_AddLabels()
+void sensors_register()
 {
-
-	windSpeed.addLabels("Wind Speed", "wind", "mph");
-	windDir.addLabels("Wind direction", "windDir", "", "&deg;");
-	windGust.addLabels("Wind Gust", "gust", "mph");
-	d_Temp_F.addLabels("Temperature", "temp", "F", "&deg;F");
-	d_Pres_mb.addLabels("Pressure (abs)", "presAbs", "mb");
-	d_Pres_seaLvl_mb.addLabels("Pressure (SL)", "presSeaLvl", "mb");
-	d_Temp_for_RH_C.addLabels("Temp for RH", "tForRH", "C", "&degC;");
-	d_RH.addLabels("Rel. Humidity", "RH", "%", "&percnt;");
-	d_IRSky_C.addLabels("Sky Temperature", "skyTemp", "C", "&degC;");
-	d_UVA.addLabels("UV A Radiation", "uvA", "");
-	d_UVB.addLabels("UV B Radiation", "uvB", "");
-	d_UVIndex.addLabels("UV Index", "uvIndex", "");
-	d_Insol.addLabels("Insolation", "sun", "%", "&percnt;");
-	d_fanRPM.addLabels("Aspirator Fan speedInstant", "fanSpeed", "rpm");
+	typedef SensorRegistry R;
+	// Gust and sustained wind are already taken over a window, so
+	// a period gets the value at its end; peak wind gets the peak.
+	windGust.setPeriodValue(PERIOD_VALUE_LAST);
+	windSustained.setPeriodValue(PERIOD_VALUE_LAST);
+	windPeak.setPeriodValue(PERIOD_VALUE_MAX);
+	// 10-min and 60-min lists hold int16 counts of 0.01 unless
+	// set here, for values beyond +-327.
+	windDir.setSeriesScale(0.1);
+	d_Pres_mb.setSeriesScale(0.1);
+	d_Pres_seaLvl_mb.setSeriesScale(0.1);
+	d_UVA.setSeriesScale(1);
+	d_UVB.setSeriesScale(1);
+	d_Insol.setSeriesScale(0.1);
+	d_fanRPM.setSeriesScale(1);
+	// Sensor, label, file prefix (short name), units, units html, chart, roles.
+	sensors.add(windSpeed,			"Wind Speed",			"wind",		"mph",	"",		CHART_WIND_SPEED,		R::ROLE_ALL);
+	sensors.add(windGust,			"Wind Gust",			"gust",		"mph",	"",		CHART_WIND_GUST,		R::ROLE_ALL & ~R::ROLE_DAY);
+	sensors.add(windSustained,		"Sustained Wind",		"windSust",	"mph",	"",		CHART_WIND_SUSTAINED,	R::ROLE_ALL);
+	sensors.add(windPeak,			"Peak Wind",			"windPeak",	"mph",	"",		CHART_WIND_PEAK,		R::ROLE_ALL & ~R::ROLE_CHART_MAX_MIN);
+	sensors.add(windDir,			"Wind direction",		"windDir",	"",		"&deg;",	CHART_WIND_DIRECTION,	R::ROLE_ALL & ~R::ROLE_CHART_MAX_MIN);
+	sensors.add(windDir.sigmaTheta(),	"Wind dir. std. dev.",	"windSigma",	"deg",	"&deg;",	CHART_WIND_SIGMA,	R::ROLE_ALL);
+	sensors.add(d_Temp_F,			"Temperature",			"temp",		"F",	"&deg;F",	CHART_TEMPERATURE_F,	R::ROLE_ALL);
+	sensors.add(d_Pres_mb,			"Pressure (abs)",		"presAbs",	"mb",	"",		CHART_NONE,				R::ROLE_10_MIN);
+	sensors.add(d_Pres_seaLvl_mb,	"Pressure (SL)",		"presSeaLvl",	"mb",	"",		CHART_PRESSURE_SEA_LEVEL,	R::ROLE_ALL);
+	sensors.add(d_Temp_for_RH_C,	"Temp for RH",			"tForRH",	"C",	"&degC;",	CHART_NONE,				R::ROLE_10_MIN);
+	sensors.add(d_RH,				"Rel. Humidity",		"RH",		"%",	"&percnt;",	CHART_RELATIVE_HUMIDITY,	R::ROLE_ALL);
+	sensors.add(d_UVA,				"UV A Radiation",		"uvA",		"",		"",		CHART_NONE,				R::ROLE_10_MIN | R::ROLE_60_MIN | R::ROLE_DAY);
+	sensors.add(d_UVB,				"UV B Radiation",		"uvB",		"",		"",		CHART_NONE,				R::ROLE_10_MIN | R::ROLE_60_MIN | R::ROLE_DAY);
+	sensors.add(d_UVIndex,			"UV Index",				"uvIndex",	"",		"",		CHART_UV_INDEX,			R::ROLE_ALL);
+	sensors.add(d_Insol,			"Insolation",			"sun",		"%",	"&percnt;",	CHART_INSOLATION,		R::ROLE_ALL);
+	sensors.add(d_IRSky_C,			"Sky Temperature",		"skyTemp",	"C",	"&degC;",	CHART_IR_SKY,			R::ROLE_ALL);
+	sensors.add(d_fanRPM,			"Aspirator Fan speedInstant",	"fanSpeed",	"rpm",	"",		CHART_NONE,				R::ROLE_NONE);
 }
 
 /// <summary>
-/// Creates data files for selected SensorData instances 
+/// Creates data files for registered SensorData instances 
 /// that save chart data on the file system.
 /// </summary>
 void sensors_createFiles()
 {
-	windSpeed.createFiles();
-	windDir.createFiles();
-	windGust.createFiles();
-	d_Temp_F.createFiles();
-	//d_Pres_mb.createFiles();
-	d_Pres_seaLvl_mb.createFiles();
-	//d_Temp_for_RH_C.createFiles(); 
-	d_RH.createFiles();
-	d_IRSky_C.createFiles();
-	//d_UVA.createFiles();         
-	//d_UVB.createFiles();         
-	d_UVIndex.createFiles();
-	d_Insol.createFiles();
-	//d_fanRPM.createFiles();      
+	sensors.createFiles();
 }
\ No newline at end of file
@@ -38,7 +38,6 @@ bool checkWifiConnection() {
 	if (WiFi.status() != WL_CONNECTED) {	// XXX THIS DID NOT WORK?!?!?!
 		// Wifi not connected.
 		unsigned long timeStart = millis();
-		bool isResetTimerCounts = true;	// Flag to reset rotation count
 		// Attempt to reconnect to wifi.
 		isConnected = false;
 		if (wifiConnect(WIFI_CONNECT_TIMEOUT_LOST_SEC)) {
@@ -60,14 +59,8 @@ bool checkWifiConnection() {
 			msg += String((millis() - timeStart) / 1000., 3) + "s";
 			sd.logStatus(msg, gps.dateTime());
 		}
-		// Reset timer interrupt counts because of delays
-		// that occurred while reconnecting wifi.
-		if (isResetTimerCounts) {
-			resetInterruptCounts();
-			String msg = "Read cycle skipped after WiFi was lost.";
-			sd.logStatus(msg, gps.dateTime());
-			isResetTimerCounts = false;	// Reset flag.
-		}
+		// Sensor reads continued in the acquisition task 
+		// while reconnecting, so no read cycle is skipped.
 		return isConnected;
 	}
 }
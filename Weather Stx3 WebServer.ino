@@ -1,10 +1,315 @@
 //// ==========   Async Web Server   ================== //
 //AsyncWebServer server(80);	// Async web server instance on port 80.
 
-chartRequested _chart_request = CHART_NONE;	// Chart requested from server.
+chartRequested _chart_request = CHART_NONE;	// Chart last requested by a legacy /chart_* route.
 
 bool _isChart_max_min = false;	// True when chart from server is max/min.
 
+/// <summary>
+/// Copy of a data series that a chunked response sends after 
+/// its handler returns, so the response never reads the lists 
+/// that period processing changes. Copies are kept in a fixed 
+/// pool, used only by handlers in the AsyncTCP task.
+/// </summary>
+struct SeriesCopy {
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> list_hi;	// Copy of first list.
+	FixedRingBuffer<dataPoint, SIZE_DAY_LIST> list_lo;	// Copy of second list, if any.
+	SeriesWriter writer{ list_hi, false, 0 };			// Writer of the copies.
+	bool isInUse = false;
+} seriesCopies[SERIES_COPY_BUFFERS];
+
+static_assert(SIZE_DAY_LIST >= SIZE_10_MIN_LIST && SIZE_DAY_LIST >= SIZE_60_MIN_LIST,
+	"SeriesCopy lists must hold the longest data series.");
+
+/// <summary>
+/// Sends an html page from the page cache, rendered at most 
+/// once per sensor reading. A browser that sends the page's 
+/// ETag in If-None-Match gets 304 Not Modified, with no body.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+/// <param name="path">Page template path in LittleFS.</param>
+void sendCachedPage(AsyncWebServerRequest* request, const char* path) {
+	PageCache::Processor processor = pageProcessor();
+	const PageCache::Page* page = pageCache.get(path, processor);
+	if (page == nullptr) {
+		// Not cached; render as the page is sent.
+		request->send(LittleFS, path, "text/html", false, processor);
+		return;
+	}
+	AsyncWebServerResponse* response;
+	AsyncWebHeader* ifNoneMatch = request->getHeader("If-None-Match");
+	if (ifNoneMatch != nullptr && ifNoneMatch->value() == page->etag) {
+		response = request->beginResponse(304);
+	}
+	else {
+		response = request->beginResponse(200, "text/html", page->body);
+	}
+	response->addHeader("ETag", page->etag);
+	// Browser must check the ETag before reusing its copy.
+	response->addHeader("Cache-Control", "no-cache");
+	request->send(response);
+}
+
+/// <summary>
+/// Names of data series in data routes, such as "/data/temp/10".
+/// </summary>
+const struct {
+	const char* name;
+	dataSeries series;
+} SERIES_ROUTE_NAMES[] = {
+	{ "10", SERIES_10_MIN },
+	{ "60", SERIES_60_MIN },
+	{ "max_min", SERIES_DAY_MAX_MIN },
+	{ "max", SERIES_DAY_MAX },
+	{ "min", SERIES_DAY_MIN }
+};
+
+/// <summary>
+/// Names of wind rose periods in data routes, such as 
+/// "/data/windDir/rose_60" (see WindDirection::stats()). 
+/// These change only in period processing.
+/// </summary>
+const struct {
+	const char* name;
+	dataPeriod period;
+} ROSE_ROUTE_NAMES[] = {
+	{ "rose_60", PERIOD_60_MIN },
+	{ "rose_day", PERIOD_DAY }
+};
+
+/// <summary>
+/// Names of archived data series in data routes, such as 
+/// "/data/temp/archive_60?from=1700000000&to=1730000000" 
+/// (times in seconds since 1970; both optional, for the 
+/// last year). See SensorData::archive_string().
+/// </summary>
+const struct {
+	const char* name;
+	dataSeries series;
+} ARCHIVE_ROUTE_NAMES[] = {
+	{ "archive_60", SERIES_60_MIN },
+	{ "archive_max_min", SERIES_DAY_MAX_MIN },
+	{ "archive_max", SERIES_DAY_MAX },
+	{ "archive_min", SERIES_DAY_MIN }
+};
+
+/// <summary>
+/// Legacy chart page routes, which set the global chart and 
+/// redirect to "/chart/[sensor short name]".
+/// </summary>
+const struct {
+	const char* route;
+	chartRequested chart;
+} LEGACY_CHART_ROUTES[] = {
+	{ "/chart_T", CHART_TEMPERATURE_F },
+	{ "/chart_W", CHART_WIND_SPEED },
+	{ "/chart_Wgst", CHART_WIND_GUST },
+	{ "/chart_Wdir", CHART_WIND_DIRECTION },
+	{ "/chart_P", CHART_PRESSURE_SEA_LEVEL },
+	{ "/chart_RH", CHART_RELATIVE_HUMIDITY },
+	{ "/chart_IR", CHART_IR_SKY },
+	{ "/chart_UVIndex", CHART_UV_INDEX },
+	{ "/chart_Insol", CHART_INSOLATION }
+};
+
+/// <summary>
+/// Legacy data routes, which redirect to the data route of 
+/// the chart last set by a legacy chart route.
+/// </summary>
+const struct {
+	const char* route;
+	const char* seriesName;
+} LEGACY_DATA_ROUTES[] = {
+	{ "/data_10", "10" },
+	{ "/data_60", "60" },
+	{ "/data_max_min", "max_min" },
+	{ "/data_max", "max" },
+	{ "/data_min", "min" }
+};
+
+/// <summary>
+/// Runs a function that reads data that period processing 
+/// changes, between period processing. Handlers must not wait 
+/// in the AsyncTCP task, so if period processing is under way 
+/// the read is retried only a few times, with no delay.
+/// </summary>
+/// <param name="read">Reads the data; may run more than once.</param>
+/// <returns>True if the data was read between period processing.</returns>
+bool readPeriodData(std::function<void()> read) {
+	for (unsigned int attempt = 0; attempt < SERIES_READ_ATTEMPTS; attempt++) {
+		unsigned int seq = seriesVersion.readBegin();
+		if ((seq & 1) == 0) {
+			read();
+			if (!seriesVersion.readRetry(seq)) {
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+/// <summary>
+/// Sends 503 Service Unavailable while period processing 
+/// changes the data series.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+void sendDataBusy(AsyncWebServerRequest* request) {
+	AsyncWebServerResponse* response = request->beginResponse(503, "text/plain", "Data series busy; try again.");
+	response->addHeader("Retry-After", "1");
+	request->send(response);
+}
+
+/// <summary>
+/// Sends text made from data that period processing changes, 
+/// made between period processing.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+/// <param name="render">Makes the text.</param>
+void sendPeriodData(AsyncWebServerRequest* request, std::function<String()> render) {
+	String text;
+	if (!readPeriodData([&text, &render]() { text = render(); })) {
+		sendDataBusy(request);
+		return;
+	}
+	request->send(200, "text/plain", text);
+}
+
+/// <summary>
+/// Sends a data series as a chunked response. The series is 
+/// copied into a SeriesCopy between period processing; the 
+/// copy's writer formats it straight into the server's 
+/// response buffer, so no String of the whole series is built.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+/// <param name="writer">Writer for the data series.</param>
+void sendSeries(AsyncWebServerRequest* request, const SeriesWriter& writer) {
+	SeriesCopy* copy = nullptr;
+	for (SeriesCopy& candidate : seriesCopies) {
+		if (!candidate.isInUse) {
+			copy = &candidate;
+			break;
+		}
+	}
+	if (copy == nullptr || !readPeriodData([copy, &writer]() {
+			copy->writer = writer.copyTo(copy->list_hi, copy->list_lo);
+		})) {
+		sendDataBusy(request);
+		return;
+	}
+	// Copy is held until the response, and the filler with it, is deleted.
+	copy->isInUse = true;
+	std::shared_ptr<SeriesCopy> held(copy, [](SeriesCopy* used) { used->isInUse = false; });
+	request->send(request->beginChunkedResponse("text/plain",
+		[held](uint8_t* buffer, size_t maxLen, size_t index) -> size_t {
+			return held->writer.read((char*)buffer, maxLen);
+		}));
+}
+
+/// <summary>
+/// Sends a data series of a sensor, or an empty 
+/// response if the sensor's chart has no such series.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+/// <param name="entry">Registered sensor.</param>
+/// <param name="series">Data series to send.</param>
+void sendChartSeries(AsyncWebServerRequest* request,
+	const SensorRegistry::Entry& entry,
+	dataSeries series)
+{
+	if (!entry.hasSeries(series)) {
+		request->send_P(200, "text/plain", "");
+		return;
+	}
+	sendSeries(request, entry.sensor->data_writer(series));
+}
+
+/// <summary>
+/// Sends the archived data series of a sensor over the 
+/// request's "from" and "to" times, or an empty response 
+/// if the sensor has no archive or chart of the series.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+/// <param name="entry">Registered sensor.</param>
+/// <param name="series">Data series to send.</param>
+void sendArchiveSeries(AsyncWebServerRequest* request,
+	const SensorRegistry::Entry& entry,
+	dataSeries series)
+{
+	if (!entry.hasSeries(series) || !entry.hasRole(SensorRegistry::ROLE_FILES | SensorRegistry::ROLE_ARCHIVE)) {
+		request->send_P(200, "text/plain", "");
+		return;
+	}
+	unsigned long timeTo = request->hasParam("to")
+		? strtoul(request->getParam("to")->value().c_str(), nullptr, 10) : now();
+	unsigned long timeFrom = request->hasParam("from")
+		? strtoul(request->getParam("from")->value().c_str(), nullptr, 10)
+		: (timeTo > ARCHIVE_QUERY_DEFAULT_SEC) ? timeTo - ARCHIVE_QUERY_DEFAULT_SEC : 0;
+	SensorData* sensor = entry.sensor;
+	// Period processing appends to the archive.
+	sendPeriodData(request, [sensor, series, timeFrom, timeTo]() {
+		return sensor->archive_string(series, timeFrom, timeTo);
+		});
+}
+
+/// <summary>
+/// Handles "/data/[sensor short name]/[series]", such as 
+/// "/data/temp/10". The sensor and series come from the url 
+/// alone, so requests for different charts can run at once.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+void handleDataRoute(AsyncWebServerRequest* request) {
+	String path = request->url().substring(strlen("/data/"));
+	int slash = path.indexOf('/');
+	const SensorRegistry::Entry* entry = (slash > 0) ? sensors.find(path.substring(0, slash)) : nullptr;
+	if (entry != nullptr) {
+		String seriesName = path.substring(slash + 1);
+		for (const auto& named : SERIES_ROUTE_NAMES) {
+			if (seriesName == named.name) {
+				sendChartSeries(request, *entry, named.series);
+				return;
+			}
+		}
+		for (const auto& named : ARCHIVE_ROUTE_NAMES) {
+			if (seriesName == named.name) {
+				sendArchiveSeries(request, *entry, named.series);
+				return;
+			}
+		}
+		if (entry->sensor == &windDir) {
+			for (const auto& named : ROSE_ROUTE_NAMES) {
+				if (seriesName == named.name) {
+					dataPeriod period = named.period;
+					sendPeriodData(request, [period]() {
+						return windDir.roseString(period);
+						});
+					return;
+				}
+			}
+		}
+	}
+	request->send(404, "text/plain", "Unknown sensor or data series: " + request->url());
+}
+
+/// <summary>
+/// Handles "/chart/[sensor short name]", such as "/chart/temp". 
+/// The page's placeholders are filled for that sensor's chart.
+/// </summary>
+/// <param name="request">Request to respond to.</param>
+void handleChartRoute(AsyncWebServerRequest* request) {
+	String name = request->url().substring(strlen("/chart/"));
+	const SensorRegistry::Entry* entry = sensors.find(name);
+	if (entry == nullptr || entry->chart == CHART_NONE) {
+		request->send(404, "text/plain", "Unknown chart: " + request->url());
+		return;
+	}
+	chartRequested chart = entry->chart;
+	ReadingsSnapshot snapshot = currentReadings.read();
+	request->send(LittleFS, "/html/chart.html", "text/html", false,
+		[chart, snapshot](const String& var) -> String {
+			return chartProcessor(var, chart, snapshot);
+		});
+}
+
 /// <summary>
 /// Defines uri routes for async web server.
 /// </summary>
@@ -89,28 +394,43 @@ void serverRouteHandler() {
 		server.serveStatic("/favicon-32.png", LittleFS, "/img/favicon-32.png").setCacheControl("max-age=864000");
 		server.serveStatic("/favicon-32.180", LittleFS, "/img/favicon-32.180").setCacheControl("max-age=864000");
 		// html 
-		// Our html pages are dynamic and can't be cached.
+		// Our html pages are dynamic and can't be cached by 
+		// max-age; sensors and summary pages are revalidated 
+		// by ETag (see sendCachedPage).
 
 		/*****  WEB PAGES.  *****/
 
 		// Default.
 		server.on("/", HTTP_GET, [](AsyncWebServerRequest* request) {
-			request->send(LittleFS, "/html/sensors.html", "text/html", false, processor);
+			sendCachedPage(request, "/html/sensors.html");
 			});
 
 		// Summary data.
 		server.on("/summary", HTTP_GET, [](AsyncWebServerRequest* request) {
-			request->send(LittleFS, "/html/summary.html", "text/html", false, processor);
+			sendCachedPage(request, "/html/summary.html");
 			});
 
 		// GPS info.
 		server.on("/gps", HTTP_GET, [](AsyncWebServerRequest* request) {
-			request->send(LittleFS, "/html/gps.html", "text/html", false, processor);
+			request->send(LittleFS, "/html/gps.html", "text/html", false, pageProcessor());
 			});
 
 		// Admin page.
 		server.on("/Admin", HTTP_GET, [](AsyncWebServerRequest* request) {
-			request->send(LittleFS, "/html/Admin.html", "text/html", false, processor);
+			request->send(LittleFS, "/html/Admin.html", "text/html", false, pageProcessor());
+			});
+
+		/*****  GRAPH PAGES AND DATA.  *****/
+
+		// Chart page and data for one sensor, given in the url.
+		// These must be defined before "/data", which would
+		// otherwise also match "/data/...".
+		server.on("/chart/*", HTTP_GET, handleChartRoute);
+		server.on("/data/*", HTTP_GET, handleDataRoute);
+
+		// Durations of task phases since the hour began.
+		server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest* request) {
+			request->send(200, "text/plain", phaseTimer.report());
 			});
 
 		// Log file from SD card.
@@ -123,63 +443,23 @@ void serverRouteHandler() {
 			request->send(SD, "/data.txt", "text/plain");
 			});
 
-		/*****  GRAPH PAGES.  *****/
-
-		// Pages use javascript to get data asynchronously.
-
-		// Temperature graph page.
-		server.on("/chart_T", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_TEMPERATURE_F;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// Wind speed graph page.
-		server.on("/chart_W", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_WIND_SPEED;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// Wind gust graph page.
-		server.on("/chart_Wgst", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_WIND_GUST;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// Wind direction graph page.
-		server.on("/chart_Wdir", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_WIND_DIRECTION;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// Pressure (sea level) graph page.
-		server.on("/chart_P", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_PRESSURE_SEA_LEVEL;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// Relative Humidity graph page.
-		server.on("/chart_RH", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_RELATIVE_HUMIDITY;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// Sky Infrared graph page.
-		server.on("/chart_IR", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_IR_SKY;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// UV Index graph page.
-		server.on("/chart_UVIndex", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_UV_INDEX;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
-
-		// Insolation graph page.
-		server.on("/chart_Insol", HTTP_GET, [](AsyncWebServerRequest* request) {
-			_chart_request = CHART_INSOLATION;
-			request->send(LittleFS, "/html/chart.html", "text/html", false, processor);
-			});
+		/*****  LEGACY GRAPH PAGES.  *****/
+
+		// Old chart pages redirect to "/chart/[sensor]". They also 
+		// set the global chart, for old pages that still request 
+		// "/data_10" and the like.
+		for (const auto& legacy : LEGACY_CHART_ROUTES) {
+			chartRequested chart = legacy.chart;
+			server.on(legacy.route, HTTP_GET, [chart](AsyncWebServerRequest* request) {
+				const SensorRegistry::Entry* entry = sensors.find(chart);
+				if (entry == nullptr) {
+					request->send(404, "text/plain", "Chart not found");
+					return;
+				}
+				_chart_request = chart;
+				request->redirect("/chart/" + entry->sensor->filenamePrefix());
+				});
+		}
 
 		/*****  Images.  *****/
 
@@ -244,230 +524,20 @@ void serverRouteHandler() {
 			 page where Javascript parses and plots the data.
 		*/
 
-		/*****  10-MIN CHARTS  *****/
-
-		server.on("/data_10", HTTP_GET,
-			[](AsyncWebServerRequest* request) {
-
-				_isChart_max_min = false;
-
-				// Which chart?
-				switch (_chart_request)
-				{
-				case CHART_NONE:
-					request->send_P(200, "text/plain", "");
-					break;
-				case CHART_INSOLATION:
-					request->send_P(200, "text/plain", d_Insol.data_10_min_string().c_str());
-					break;
-				case CHART_IR_SKY:
-					request->send_P(200, "text/plain", d_IRSky_C.data_10_min_string().c_str());
-					break;
-				case CHART_TEMPERATURE_F:
-					request->send_P(200, "text/plain", d_Temp_F.data_10_min_string().c_str());
-					break;
-				case CHART_PRESSURE_SEA_LEVEL:
-					request->send_P(200, "text/plain", d_Pres_seaLvl_mb.data_10_min_string().c_str());
-					break;
-				case CHART_RELATIVE_HUMIDITY:
-					request->send_P(200, "text/plain", d_RH.data_10_min_string().c_str());
-					break;
-				case CHART_UV_INDEX:
-					request->send_P(200, "text/plain", d_UVIndex.data_10_min_string().c_str());
-					break;
-				case CHART_WIND_DIRECTION:
-					request->send_P(200, "text/plain", windDir.data_10_min_string().c_str());
-					break;
-				case CHART_WIND_SPEED:
-					request->send_P(200, "text/plain", windSpeed.data_10_min_string().c_str());
-					break;
-				case CHART_WIND_GUST:
-					request->send_P(200, "text/plain", windGust.data_10_min_string().c_str());
-					break;
-				default:
-					request->send_P(200, "text/plain", "");
-					break;
-				}
-			});
-
-		/*****  60-MIN CHARTS  *****/
-
-		server.on("/data_60", HTTP_GET,
-			[](AsyncWebServerRequest* request) {
-
-				_isChart_max_min = false;
-
-				// Which chart?
-				switch (_chart_request)
-				{
-				case CHART_NONE:
-					request->send_P(200, "text/plain", "");
-					break;
-				case CHART_INSOLATION:
-					request->send_P(200, "text/plain", d_Insol.data_60_min_string().c_str());
-					break;
-				case CHART_IR_SKY:
-					request->send_P(200, "text/plain", d_IRSky_C.data_60_min_string().c_str());
-					break;
-				case CHART_TEMPERATURE_F:
-					request->send_P(200, "text/plain", d_Temp_F.data_60_min_string().c_str());
-					break;
-				case CHART_PRESSURE_SEA_LEVEL:
-					request->send_P(200, "text/plain", d_Pres_seaLvl_mb.data_60_min_string().c_str());
-					break;
-				case CHART_RELATIVE_HUMIDITY:
-					request->send_P(200, "text/plain", d_RH.data_60_min_string().c_str());
-					break;
-				case CHART_UV_INDEX:
-					request->send_P(200, "text/plain", d_UVIndex.data_60_min_string().c_str());
-					break;
-				case CHART_WIND_DIRECTION:
-					request->send_P(200, "text/plain", windDir.data_60_min_string().c_str());
-					break;
-				case CHART_WIND_SPEED:
-					request->send_P(200, "text/plain", windSpeed.data_60_min_string().c_str());
-					break;
-				case CHART_WIND_GUST:
-					request->send_P(200, "text/plain", windGust.data_60_min_string().c_str());
-					break;
-				default:
-					request->send_P(200, "text/plain", "");
-					break;
-				}
-			});
-
-		/*****  DAILY MIN MAX CHARTS  *****/
-
-		server.on("/data_max_min", HTTP_GET,
-			[](AsyncWebServerRequest* request) {
-
-				_isChart_max_min = true;
-
-				// Which chart?
-				switch (_chart_request)
-				{
-				case CHART_NONE:
-					request->send_P(200, "text/plain", "");
-					break;
-				case CHART_INSOLATION:
-					request->send_P(200, "text/plain", d_Insol.data_dayMaxMin_string().c_str());
-					break;
-				case CHART_IR_SKY:
-					request->send_P(200, "text/plain", d_IRSky_C.data_dayMaxMin_string().c_str());
-					break;
-				case CHART_TEMPERATURE_F:
-					request->send_P(200, "text/plain", d_Temp_F.data_dayMaxMin_string().c_str());
-					break;
-				case CHART_PRESSURE_SEA_LEVEL:
-					request->send_P(200, "text/plain", d_Pres_seaLvl_mb.data_dayMaxMin_string().c_str());
-					break;
-				case CHART_RELATIVE_HUMIDITY:
-					request->send_P(200, "text/plain", d_RH.data_dayMaxMin_string().c_str());
-					break;
-				case CHART_UV_INDEX:
-					request->send_P(200, "text/plain", d_UVIndex.data_dayMaxMin_string().c_str());
-					break;
-					/*case CHART_WIND_DIRECTION:
-						request->send_P(200, "text/plain", windDir.data_max_min_string_delim().c_str());
-						break;*/
-				case CHART_WIND_SPEED:
-					request->send_P(200, "text/plain", windSpeed.data_dayMaxMin_string().c_str());
-					break;
-				case CHART_WIND_GUST:
-					request->send_P(200, "text/plain", windGust.data_dayMaxMin_string().c_str());
-					break;
-				default:
-					request->send_P(200, "text/plain", "");
-					break;
-				}
-			});
-
-		/*****  DAILY MAXIMA CHARTS  *****/
+		/*****  LEGACY DATA SOURCES  *****/
 
-		server.on("/data_max", HTTP_GET,
-			[](AsyncWebServerRequest* request) {
-				// Which chart?
-				switch (_chart_request)
-				{
-				case CHART_NONE:
-					request->send_P(200, "text/plain", "");
-					break;
-				case CHART_INSOLATION:
-					request->send_P(200, "text/plain", d_Insol.data_dayMax_string().c_str());
-					break;
-				case CHART_IR_SKY:
-					request->send_P(200, "text/plain", d_IRSky_C.data_dayMax_string().c_str());
-					break;
-				case CHART_TEMPERATURE_F:
-					request->send_P(200, "text/plain", d_Temp_F.data_dayMax_string().c_str());
-					break;
-				case CHART_PRESSURE_SEA_LEVEL:
-					request->send_P(200, "text/plain", d_Pres_seaLvl_mb.data_dayMax_string().c_str());
-					break;
-				case CHART_RELATIVE_HUMIDITY:
-					request->send_P(200, "text/plain", d_RH.data_dayMax_string().c_str());
-					break;
-				case CHART_UV_INDEX:
-					request->send_P(200, "text/plain", d_UVIndex.data_dayMax_string().c_str());
-					break;
-				case CHART_WIND_DIRECTION:
-					request->send_P(200, "text/plain", windDir.data_dayMax_string().c_str());
-					break;
-				case CHART_WIND_SPEED:
-					request->send_P(200, "text/plain", windSpeed.data_dayMax_string().c_str());
-					break;
-				case CHART_WIND_GUST:
-					request->send_P(200, "text/plain", windGust.data_dayMax_string().c_str());
-					break;
-				default:
+		// Redirect to the data route of the chart set by a legacy chart route.
+		for (const auto& legacy : LEGACY_DATA_ROUTES) {
+			const char* seriesName = legacy.seriesName;
+			server.on(legacy.route, HTTP_GET, [seriesName](AsyncWebServerRequest* request) {
+				const SensorRegistry::Entry* entry = sensors.find(_chart_request);
+				if (entry == nullptr) {
 					request->send_P(200, "text/plain", "");
-					break;
+					return;
 				}
-			});
-
-		/*****  DAILY MINIMA CHARTS  *****/
-
-		server.on("/data_min", HTTP_GET,
-			[](AsyncWebServerRequest* request) {
-				// Which chart?
-				switch (_chart_request)
-				{
-				case CHART_NONE:
-					request->send_P(200, "text/plain", "");
-					break;
-				case CHART_INSOLATION:
-					request->send_P(200, "text/plain", d_Insol.data_dayMin_string().c_str());
-					break;
-				case CHART_IR_SKY:
-					request->send_P(200, "text/plain", d_IRSky_C.data_dayMin_string().c_str());
-					break;
-				case CHART_TEMPERATURE_F:
-					//request->send_P(200, "text/plain", d_Temp_F.data_dayMin_string().c_str());
-					request->send_P(200, "text/plain", d_Temp_F.data_dayMin_string().c_str());
-					break;
-				case CHART_PRESSURE_SEA_LEVEL:
-					request->send_P(200, "text/plain", d_Pres_seaLvl_mb.data_dayMin_string().c_str());
-					break;
-				case CHART_RELATIVE_HUMIDITY:
-					request->send_P(200, "text/plain", d_RH.data_dayMin_string().c_str());
-					break;
-				case CHART_UV_INDEX:
-					request->send_P(200, "text/plain", d_UVIndex.data_dayMin_string().c_str());
-					break;
-				case CHART_WIND_DIRECTION:
-					request->send_P(200, "text/plain", windDir.data_dayMin_string().c_str());
-					break;
-				case CHART_WIND_SPEED:
-					request->send_P(200, "text/plain", windSpeed.data_dayMin_string().c_str());
-					break;
-				case CHART_WIND_GUST:
-					request->send_P(200, "text/plain", windGust.data_dayMin_string().c_str());
-					break;
-				default:
-					request->send_P(200, "text/plain", "");
-					break;
-				}
-			});
+				request->redirect("/data/" + entry->sensor->filenamePrefix() + "/" + seriesName);
+				});
+		}
 
 #if defined(VM_DEBUG)
 }
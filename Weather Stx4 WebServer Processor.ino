@@ -7,10 +7,47 @@
 /// <param name="var">Placeholder identifier.</param>
 /// <returns>String substituted for placeholder.</returns>
 String processor(const String& var) {
+	return processPlaceholder(Placeholders::find(var.c_str()), var, currentReadings.read());
+}
 
+/// <summary>
+/// Returns a processor that fills all of a page's placeholders
+/// from one snapshot of the current readings, so the values on
+/// a page are from the same sample.
+/// </summary>
+/// <returns>Placeholder processor.</returns>
+PageCache::Processor pageProcessor() {
+	ReadingsSnapshot snapshot = currentReadings.read();
+	return [snapshot](const String& var) -> String {
+		return processPlaceholder(Placeholders::find(var.c_str()), var, snapshot);
+	};
+}
+
+/// <summary>
+/// Returns the String substituted for a placeholder. The
+/// name is looked up once (by binary search in a sorted
+/// table), and this switches on its id, instead of
+/// comparing the name with every known placeholder.
+/// </summary>
+/// <param name="id">Placeholder id from Placeholders::find().</param>
+/// <param name="var">Placeholder identifier.</param>
+/// <param name="snapshot">Current readings.</param>
+/// <returns>String substituted for placeholder.</returns>
+String processPlaceholder(Placeholders::placeholderId id,
+	const String& var,
+	const ReadingsSnapshot& snapshot)
+{
+	// Current values come from the snapshot, not the SensorData
+	// instances, which the processing task changes meanwhile.
+	auto values = [&snapshot](const SensorData& sensor) -> const ReadingsSnapshot::Values& {
+		return snapshot.of(sensors, sensor);
+	};
+
+	switch (id)
+	{
 	/// CSS LIGHT STYLE DURING DAY  //////////////
 
-	if (var == "CSS_LIGHT_STYLE") {
+	case Placeholders::PH_CSS_LIGHT_STYLE:
 		// Switch display theme when ambient light is,
 		// detected by normalized insolation %.
 
@@ -24,218 +61,203 @@ String processor(const String& var) {
 		//////else {
 		//////	return "";
 		//////}*/
-	}
 
 	///  CURRENT SENSOR READINGS  ///////////////////
 
 	// Returns running avg of current 10-min 
 	// period (except for gust and wind dir).
 
-	if (var == "LAST_READINGS_DATETIME") {
+	case Placeholders::PH_LAST_READINGS_DATETIME:
 		return gps.dateTime();
-	}
-	if (var == "CURRENT_TIME") {
+	case Placeholders::PH_CURRENT_TIME:
 		return gps.time();
-	}
-	if (var == "WEEKDAY") {
+	case Placeholders::PH_WEEKDAY:
 		return String(gps.dayName());
-	}
-	if (var == "TEMPERATURE_F")
-		return String(d_Temp_F.avg_now(), 0);
-	if (var == "WIND_SPEED") {
-		return String(windSpeed.avg_now(), 0);	// 10-min avg
-	}
-	if (var == "WIND_GUST") {
-		return String(windGust.max_10_min().value, 0);	// 10-min max for gusts
-	}
-	if (var == "WIND_DIRECTION") {
-		return String(windDir.directionCardinal());		// avg since last cleared (<= 10 min)
-	}
-	if (var == "WIND_ANGLE") {
-		return String(windDir.angleAvg_now(), 0);		// avg since last cleared (<= 10 min)
-	}
-	if (var == "GPS_ALTITUDE") {
+	case Placeholders::PH_TEMPERATURE_F:
+		return String(values(d_Temp_F).avg_now, 0);
+	case Placeholders::PH_WIND_SPEED:
+		return String(values(windSpeed).avg_now, 0);	// 10-min avg
+	case Placeholders::PH_WIND_GUST:
+		return String(values(windGust).max_10_min, 0);	// 10-min max for gusts
+	case Placeholders::PH_WIND_DIRECTION:
+		return windDir.directionCardinal(snapshot.windAngle_10_min);	// last 10-min avg
+	case Placeholders::PH_WIND_ANGLE:
+		return String(snapshot.windAngle_now, 0);		// avg since last cleared (<= 10 min)
+	case Placeholders::PH_GPS_ALTITUDE:
 		return String(gps.data.altitude(), 0);
-	}
-	if (var == "PRESSURE_MB_SL") {
-		return String(d_Pres_seaLvl_mb.avg_now(), 0);
-	}
-	if (var == "PRESSURE_MB_ABS") {
-		return String(d_Pres_mb.avg_now(), 0);
-	}
-	if (var == "WATER_BOILING_POINT") {
-		return String(waterBoilingPoint_F(d_Pres_mb.avg_now()), 0);
-	}
-	if (var == "INSOLATION_PERCENT") {
-		return String(d_Insol.avg_now(), 0);
-	}
-	if (var == "REL_HUMIDITY") {
-		return String(d_RH.avg_now(), 0);
-	}
-	if (var == "UV_A") {
+	case Placeholders::PH_PRESSURE_MB_SL:
+		return String(values(d_Pres_seaLvl_mb).avg_now, 0);
+	case Placeholders::PH_PRESSURE_MB_ABS:
+		return String(values(d_Pres_mb).avg_now, 0);
+	case Placeholders::PH_WATER_BOILING_POINT:
+		return String(waterBoilingPoint_F(values(d_Pres_mb).avg_now), 0);
+	case Placeholders::PH_INSOLATION_PERCENT:
+		return String(values(d_Insol).avg_now, 0);
+	case Placeholders::PH_REL_HUMIDITY:
+		return String(values(d_RH).avg_now, 0);
+	case Placeholders::PH_UV_A:
 		if (_isGood_UV) {
-			return String(d_UVA.avg_now(), 0);
+			return String(values(d_UVA).avg_now, 0);
 		}
 		else {
 			return String("na");
 		}
-	}
-	if (var == "UV_B") {
+	case Placeholders::PH_UV_B:
 		if (_isGood_UV) {
-			return String(d_UVB.avg_now(), 0);
+			return String(values(d_UVB).avg_now, 0);
 		}
 		else {
 			return String("na");
 		}
-	}
-	if (var == "UV_INDEX") {
+	case Placeholders::PH_UV_INDEX:
 		//if (_isGood_UV) {
-		return String(d_UVIndex.avg_now(), 1);
+		return String(values(d_UVIndex).avg_now, 1);
 		//}
 		//else {
 		//	return String("na");
 		//}
-	}
-	if (var == "IR_T_SKY") {
-		return String(d_IRSky_C.avg_now(), 0);
-	}
+	case Placeholders::PH_IR_T_SKY:
+		return String(values(d_IRSky_C).avg_now, 0);
 
 	///  DAILY MAXIMA  ///////////////////
 
-	if (var == "TEMPERATURE_F_HI") {
-		return String(d_Temp_F.max_today().value, 0);
-	}
-	if (var == "WIND_SPEED_HI") {
-		return String(windSpeed.max_today().value, 0);
-	}
-	if (var == "WIND_GUST_HI") {
-		return String(windGust.max_today().value, 0);
-	}
-	if (var == "WIND_ANGLE_HI") {
+	case Placeholders::PH_TEMPERATURE_F_HI:
+		return String(values(d_Temp_F).max_today, 0);
+	case Placeholders::PH_WIND_SPEED_HI:
+		return String(values(windSpeed).max_today, 0);
+	case Placeholders::PH_WIND_GUST_HI:
+		return String(values(windGust).max_today, 0);
+	case Placeholders::PH_WIND_ANGLE_HI:
 		return "??";		// avg since last cleared (<= 10 min)
-	}
-	if (var == "PRESSURE_MB_SL_HI") {
-		return String(d_Pres_seaLvl_mb.max_today().value, 0);
-	}
-	if (var == "INSOLATION_PERCENT_HI") {
-		return String(d_Insol.max_today().value, 0);
-	}
-	if (var == "REL_HUMIDITY_HI") {
-		return String(d_RH.max_today().value, 0);
-	}
-	if (var == "UV_A_HI") {
+	case Placeholders::PH_PRESSURE_MB_SL_HI:
+		return String(values(d_Pres_seaLvl_mb).max_today, 0);
+	case Placeholders::PH_INSOLATION_PERCENT_HI:
+		return String(values(d_Insol).max_today, 0);
+	case Placeholders::PH_REL_HUMIDITY_HI:
+		return String(values(d_RH).max_today, 0);
+	case Placeholders::PH_UV_A_HI:
 		if (_isGood_UV) {
-			return String(d_UVA.max_today().value, 0);
+			return String(values(d_UVA).max_today, 0);
 		}
 		else {
 			return String("na");
 		}
-	}
-	if (var == "UV_B_HI") {
+	case Placeholders::PH_UV_B_HI:
 		if (_isGood_UV) {
-			return String(d_UVB.max_today().value, 0);
+			return String(values(d_UVB).max_today, 0);
 		}
 		else {
 			return String("na");
 		}
-	}
-	if (var == "UV_INDEX_HI") {
+	case Placeholders::PH_UV_INDEX_HI:
 		if (_isGood_UV) {
-			return String(d_UVIndex.max_today().value, 1);
+			return String(values(d_UVIndex).max_today, 1);
 		}
 		else {
 			return String("na");
 		}
-	}
-	if (var == "IR_T_SKY_HI") {
-		return String(d_IRSky_C.max_today().value, 0);
-	}
+	case Placeholders::PH_IR_T_SKY_HI:
+		return String(values(d_IRSky_C).max_today, 0);
 
 	///  DAILY MINIMA  ///////////////////
 
-	if (var == "TEMPERATURE_F_LO") {
-		return String(d_Temp_F.min_today().value, 0);
-	}
-	if (var == "WIND_SPEED_LO") {
-		return String(windSpeed.min_today().value, 0);	// 10-min avg
-	}
-	if (var == "WIND_GUST_LO") {
-		return String(windGust.min_today().value, 0);
-	}
-	if (var == "PRESSURE_MB_SL_LO") {
-		return String(d_Pres_seaLvl_mb.min_today().value, 0);
-	}
-	if (var == "REL_HUMIDITY_LO") {
-		return String(d_RH.min_today().value, 0);
-	}
-	if (var == "IR_T_SKY_LO") {
-		return String(d_IRSky_C.min_today().value, 0);
-	}
+	case Placeholders::PH_TEMPERATURE_F_LO:
+		return String(values(d_Temp_F).min_today, 0);
+	case Placeholders::PH_WIND_SPEED_LO:
+		return String(values(windSpeed).min_today, 0);	// 10-min avg
+	case Placeholders::PH_WIND_GUST_LO:
+		return String(values(windGust).min_today, 0);
+	case Placeholders::PH_PRESSURE_MB_SL_LO:
+		return String(values(d_Pres_seaLvl_mb).min_today, 0);
+	case Placeholders::PH_REL_HUMIDITY_LO:
+		return String(values(d_RH).min_today, 0);
+	case Placeholders::PH_IR_T_SKY_LO:
+		return String(values(d_IRSky_C).min_today, 0);
 
 	///  GPS DATA   ////////////////////////
 
-	if (var == "GPS_IS_SYNCED") {
+	case Placeholders::PH_GPS_IS_SYNCED:
 		if (gps.isSynced())
 			return String("Synced");
 		else
 			return String("Not Synced");
-	}
-	if (var == "GPS_LOCATIONS_UPDATE_COUNTER") {
+	case Placeholders::PH_GPS_LOCATIONS_UPDATE_COUNTER:
 		return String(gps.cyclesCount());
-	}
-	if (var == "GPS_LATITUDE") {
+	case Placeholders::PH_GPS_LATITUDE:
 		return String(gps.data.latitude(), 6);
-	}
-	if (var == "GPS_LONGITUDE") {
+	case Placeholders::PH_GPS_LONGITUDE:
 		return String(gps.data.longitude(), 6);
-	}
-	if (var == "GPS_ALTITUDE") {
-		return String(gps.data.altitude());
-	}
-	if (var == "GPS_DATE") {
+	case Placeholders::PH_GPS_DATE:
 		return String(gps.date_UTC_GPS());
-	}
-	if (var == "GPS_TIME") {
+	case Placeholders::PH_GPS_TIME:
 		return String(gps.time_UTC_GPS());
-	}
-	/*if (var == "GPS_UTC_OFFSET") {
-		return String(UTC_OFFSET_HOURS);
-	}*/
-	if (var == "GPS_DAYLIGHT_TIME_USED") {
+	/*case Placeholders::PH_GPS_UTC_OFFSET:
+		return String(UTC_OFFSET_HOURS);*/
+	case Placeholders::PH_GPS_DAYLIGHT_TIME_USED:
 		return bool_Yes_No(IS_DAYLIGHT_TIME);
-	}
-	if (var == "GPS_HDOP") {
+	case Placeholders::PH_GPS_HDOP:
 		return String(gps.data.HDOP() / 100.);
-	}
-	if (var == "GPS_SATELLITES") {
+	case Placeholders::PH_GPS_SATELLITES:
 		return String(gps.data.satellites());
-	}
-	if (var == "ELAPSED_TIME_STRING") {
+	case Placeholders::PH_ELAPSED_TIME_STRING:
 		return   String(gps.data.timeToSync_sec(), 2);
-	}
-	if (var == "FAN_RPM") {
-		return String(d_fanRPM.valueLastAdded());
-	}
+	case Placeholders::PH_FAN_RPM:
+		return String(values(d_fanRPM).last);
 
 	/// CHART FIELDS  //////////////////////////////////////////////
 
-
-
-	if (var == "UTC_CURRENT_OFFSET_HOURS") {
+	case Placeholders::PH_UTC_CURRENT_OFFSET_HOURS:
 		if (IS_DAYLIGHT_TIME) {
 			return String(UTC_OFFSET_HOURS + 1);
 		}
 		else {
 			return  String(UTC_OFFSET_HOURS);
 		}
+
+	/*/// LEGEND DISPLAY  //////////////
+
+	case Placeholders::PH_IS_LEGEND:
+		if (_isChart_max_min) {
+			return "true";
+		}
+		else {
+			return "false";
+		}*/
+
+	default:
+		// Chart placeholders are handled by chartProcessor().
+		return var + String(" not found");
 	}
+}
+
+/// <summary>
+/// Replaces %PLACEHOLDER% elements in the chart page
+/// for one chart. Placeholders that are not chart
+/// fields are passed to processPlaceholder().
+/// </summary>
+/// <param name="var">Placeholder identifier.</param>
+/// <param name="chart">Chart shown on the page.</param>
+/// <param name="snapshot">Current readings.</param>
+/// <returns>String substituted for placeholder.</returns>
+String chartProcessor(const String& var, chartRequested chart, const ReadingsSnapshot& snapshot) {
+
+	Placeholders::placeholderId id = Placeholders::find(var.c_str());
+	switch (id)
+	{
+	/// DATA ROUTE  //////////////
 
+	case Placeholders::PH_CHART_DATA_ROUTE:
+	{
+		// Page appends the series, such as "/10".
+		const SensorRegistry::Entry* entry = sensors.find(chart);
+		return (entry != nullptr) ? "/data/" + entry->sensor->filenamePrefix() : String("/data/none");
+	}
 
 	/// Y-AXIS LABEL  //////////////
 
-	if (var == "CHART_Y_AXIS_LABEL") {
+	case Placeholders::PH_CHART_Y_AXIS_LABEL:
 		// Based on chart requested.
-		switch (_chart_request)
+		switch (chart)
 		{
 		case CHART_NONE:
 			return "Chart not specified!";
@@ -253,20 +275,25 @@ String processor(const String& var) {
 			return String(d_UVIndex.label() + ", " + d_UVIndex.units());
 		case CHART_WIND_DIRECTION:
 			return String(windDir.label() + ", " + windDir.units_html());
+		case CHART_WIND_SIGMA:
+			return String(windDir.sigmaTheta().label() + ", " + windDir.sigmaTheta().units_html());
 		case CHART_WIND_SPEED:
 			return String(windSpeed.label() + ", " + windSpeed.units());
 		case CHART_WIND_GUST:
 			return String("Wind Gusts, " + windGust.units());
+		case CHART_WIND_SUSTAINED:
+			return String(windSustained.label() + ", " + windSustained.units());
+		case CHART_WIND_PEAK:
+			return String(windPeak.label() + ", " + windPeak.units());
 		default:
 			return "Chart not found";
 		}
-	}
 
 	/// CHART TITLE  //////////////
 
-	if (var == "CHART_TITLE") {
+	case Placeholders::PH_CHART_TITLE:
 		// Based on chart requested.
-		switch (_chart_request)
+		switch (chart)
 		{
 		case CHART_NONE:
 			return "Chart not specified!";
@@ -284,18 +311,25 @@ String processor(const String& var) {
 			return String(d_UVIndex.label());
 		case CHART_WIND_DIRECTION:
 			return String(windDir.label());
+		case CHART_WIND_SIGMA:
+			return String(windDir.sigmaTheta().label());
 		case CHART_WIND_SPEED:
 			return String(windSpeed.label());
 		case CHART_WIND_GUST:
 			return "Wind Gusts";
+		case CHART_WIND_SUSTAINED:
+			return String(windSustained.label());
+		case CHART_WIND_PEAK:
+			return String(windPeak.label());
+		default:
+			return "Chart not found";
 		}
-	}
 
 	/// Y-AXIS MIN  //////////////
 
-	if (var == "Y_MIN") {
+	case Placeholders::PH_Y_MIN:
 		// Based on chart requested.
-		switch (_chart_request)
+		switch (chart)
 		{
 		case CHART_NONE:
 			return "min: -500";
@@ -313,20 +347,25 @@ String processor(const String& var) {
 			return "min: 0";
 		case CHART_WIND_DIRECTION:
 			return "min: 0";
+		case CHART_WIND_SIGMA:
+			return "min: 0";
 		case CHART_WIND_SPEED:
 			return "min: 0";
 		case CHART_WIND_GUST:
 			return "min: 0";
+		case CHART_WIND_SUSTAINED:
+			return "min: 0";
+		case CHART_WIND_PEAK:
+			return "min: 0";
 		default:
 			return "min: -2000";
 		}
-	}
 
 	/// Y-AXIS MAX  //////////////
 
-	if (var == "Y_MAX") {
+	case Placeholders::PH_Y_MAX:
 		// Based on chart requested.
-		switch (_chart_request)
+		switch (chart)
 		{
 		case CHART_NONE:
 			return ", max: 500";
@@ -344,20 +383,25 @@ String processor(const String& var) {
 			return ", max: 20";
 		case CHART_WIND_DIRECTION:
 			return ", max: 360";
+		case CHART_WIND_SIGMA:
+			return ", max: 105";
 		case CHART_WIND_SPEED:
 			return ", max: 50";
 		case CHART_WIND_GUST:
 			return ", max: 50";
+		case CHART_WIND_SUSTAINED:
+			return ", max: 50";
+		case CHART_WIND_PEAK:
+			return ", max: 50";
 		default:
 			return ", max: 2000";
 		}
-	}
 
 	/// Y-AXIS TICK AMOUNT  //////////////
 
-	if (var == "Y_TICK_AMOUNT") {
+	case Placeholders::PH_Y_TICK_AMOUNT:
 		// Based on chart requested.
-		switch (_chart_request)
+		switch (chart)
 		{
 		case CHART_IR_SKY:
 			return ", tickAmount: 5";
@@ -371,21 +415,15 @@ String processor(const String& var) {
 			return ", tickAmount: 6";
 		case CHART_WIND_GUST:
 			return ", tickAmount: 6";
+		case CHART_WIND_SUSTAINED:
+			return ", tickAmount: 6";
+		case CHART_WIND_PEAK:
+			return ", tickAmount: 6";
 		default:
 			return "";
 		}
-	}
-
-	/*/// LEGEND DISPLAY  //////////////
-
-	if (var == "IS_LEGEND") {
-		if (_isChart_max_min) {
-			return "true";
-		}
-		else {
-			return "false";
-		}
-	}*/
 
-	return var + String(" not found");
-}
\ No newline at end of file
+	default:
+		return processPlaceholder(id, var, snapshot);
+	}
+}
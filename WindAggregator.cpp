@@ -0,0 +1,46 @@
+// 
+// 
+// 
+
+#include "WindAggregator.h"
+
+/// <summary>
+/// Adds a base period.
+/// </summary>
+/// <param name="speed">Speed over the period, mph.</param>
+/// <param name="peak">Peak 3-s speed in the period, mph.</param>
+void WindAggregator::add(float speed, float peak) {
+	_sustained.add(speed);
+	_lulls.add(speed);
+	_peaks.add(std::max(speed, peak));
+}
+
+/// <summary>
+/// Removes all periods.
+/// </summary>
+void WindAggregator::clear() {
+	_sustained.clear();
+	_lulls.clear();
+	_peaks.clear();
+}
+
+/// <summary>
+/// Returns the 10-min peak if it is a gust, else 0, mph.
+/// </summary>
+float WindAggregator::gust() const {
+	float peakSpeed = peak();
+	if (peakSpeed >= App_Settings::GUST_THRESHOLD
+		&& peakSpeed - lull() >= App_Settings::GUST_SPREAD) {
+		return peakSpeed;
+	}
+	return 0;
+}
+
+/// <summary>
+/// Returns the peak of the last period if it is a
+/// peak wind, else 0, mph.
+/// </summary>
+float WindAggregator::peakWind() const {
+	float peakSpeed = _peaks.newest();
+	return (peakSpeed > App_Settings::PEAK_WIND_THRESHOLD) ? peakSpeed : 0;
+}
@@ -0,0 +1,74 @@
+// WindAggregator.h
+
+#ifndef _WINDAGGREGATOR_h
+#define _WINDAGGREGATOR_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include <algorithm>
+#include "App_Settings.h"
+#include "SlidingWindow.h"
+
+/// <summary>
+/// Streaming wind stage, after the NWS definitions in
+/// ReadMe_wind.md. Each base period adds its speed and peak;
+/// from rolling windows of these it gives the 2-min sustained
+/// wind, the 10-min lull and peak, the gust (peak, if it beats
+/// the lull by GUST_SPREAD) and the peak wind (above
+/// PEAK_WIND_THRESHOLD). Every call is O(1).
+/// </summary>
+class WindAggregator {
+
+public:
+
+	/// <summary>
+	/// Adds a base period.
+	/// </summary>
+	/// <param name="speed">Speed over the period, mph.</param>
+	/// <param name="peak">Peak 3-s speed in the period, mph.</param>
+	void add(float speed, float peak);
+
+	/// <summary>
+	/// Removes all periods.
+	/// </summary>
+	void clear();
+
+	/// <summary>
+	/// Returns the average speed of the last 2 min (the
+	/// sustained wind), mph.
+	/// </summary>
+	float sustained() const { return _sustained.average(); }
+
+	/// <summary>
+	/// Returns the lowest speed of the last 10 min, mph.
+	/// </summary>
+	float lull() const { return _lulls.minimum(); }
+
+	/// <summary>
+	/// Returns the highest peak of the last 10 min, mph.
+	/// </summary>
+	float peak() const { return _peaks.maximum(); }
+
+	/// <summary>
+	/// Returns the 10-min peak if it is a gust, else 0, mph.
+	/// </summary>
+	float gust() const;
+
+	/// <summary>
+	/// Returns the peak of the last period if it is a
+	/// peak wind, else 0, mph.
+	/// </summary>
+	float peakWind() const;
+
+private:
+
+	SlidingWindow<App_Settings::SUSTAINED_WIND_PERIODS> _sustained;	// Speeds, 2 min.
+	SlidingWindow<App_Settings::BASE_PERIODS_IN_10_MIN> _lulls;		// Speeds, 10 min.
+	SlidingWindow<App_Settings::BASE_PERIODS_IN_10_MIN> _peaks;		// Peaks, 10 min.
+};
+
+#endif
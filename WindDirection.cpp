@@ -3,6 +3,11 @@
 // 
 
 #include "WindDirection.h"
+#include "Utilities.h"
+#include <TimeLib.h>
+
+const uint32_t WindDirection::ROSE_MAGIC;
+const uint16_t WindDirection::ROSE_VERSION;
 
 /// <summary>
 /// Create with an angle offset to subtract from readings.
@@ -10,7 +15,8 @@
 /// <param name="offsetAngle">
 /// Degrees by which reading exceeds true north.
 /// </param>
-WindDirection::WindDirection(float offsetAngle) {
+WindDirection::WindDirection(float offsetAngle)
+	: _sigmaTheta(true, false, false) {	// One reading per 10 min; no smoothing.
 	_offsetAngle = offsetAngle;
 }
 
@@ -67,13 +73,153 @@ void WindDirection::addReading(long time, float degrees, float speed) {
 	///////////_timeLastAdded = time;
 	// Only record direction for speeds greater than threshold.
 	if (speed >= WIND_DIRECTION_SPEED_THRESHOLD) {
-		degrees -= _offsetAngle;	// Adjust for any offset.
+		// Vane readings are whole degrees, so the components
+		// come straight from the table (see FastTrig).
+		int angle = (int)lroundf(degrees - _offsetAngle);	// Adjust for any offset.
 		// Converts angle into North and East components of
 		// the direction vector and sums each component.
 		// Weight these by the speed.
-		_eSum += e_Component(degrees) * speed;
-		_nSum += n_Component(degrees) * speed;
+		_eSum += FastTrig::sinDeg(angle) * speed;
+		_nSum += FastTrig::cosDeg(angle) * speed;
+		_stats_10_min.add(angle);
+	}
+}
+
+/// <summary>
+/// Adds the 10-min sigma-theta to its sensor and rolls the
+/// wind rose stats up, then processes the averages.
+/// </summary>
+/// <param name="period">Period that has ended.</param>
+void WindDirection::process_data(dataPeriod period) {
+	switch (period)
+	{
+	case App_Settings::PERIOD_10_MIN:
+		// The sigma sensor is registered after this one, so the
+		// registry processes its reading next. A calm period has
+		// no directions; NaN keeps it from charting as steady wind.
+		_sigmaTheta.addReading(dataPoint(_dataPointLastAdded.time,
+			(_stats_10_min.count() > 0) ? _stats_10_min.sigmaTheta() : NAN));
+		_stats_60_min.merge(_stats_10_min);
+		_stats_day.merge(_stats_10_min);
+		_stats_10_min.clear();
+		break;
+	case App_Settings::PERIOD_60_MIN:
+		_stats_lastHour = _stats_60_min;
+		_stats_60_min.clear();
+		break;
+	case App_Settings::PERIOD_DAY:
+		_stats_day.clear();
+		break;
+	default:
+		break;
+	}
+	if (_isRoseFile) {
+		saveRose(now());
+	}
+	SensorData::process_data(period);
+}
+
+/// <summary>
+/// Writes the rose stats of today and this hour to LittleFS.
+/// </summary>
+/// <param name="time">Current time, sec.</param>
+void WindDirection::saveRose(unsigned long time) {
+	RoseFile rose;
+	memset((void*)&rose, 0, sizeof(rose));	// Zero padding for the CRC.
+	rose.magic = ROSE_MAGIC;
+	rose.version = ROSE_VERSION;
+	rose.statsSize = sizeof(CircularStats);
+	rose.time = time;
+	rose.day = _stats_day;
+	rose.hour = _stats_60_min;
+	rose.lastHour = _stats_lastHour;
+	rose.crc = Utilities::crc32(&rose, offsetof(RoseFile, crc));
+
+	String path = sensorFilepath("_rose", ".bin");
+	File file = LittleFS.open(path.c_str(), FILE_WRITE);
+	if (!file || file.write((const uint8_t*)&rose, sizeof(rose)) != sizeof(rose)) {
+		Serial.printf("ERROR: WindDirection could not write %s\n", path.c_str());
+	}
+	if (file) {
+		file.close();
+	}
+}
+
+/// <summary>
+/// Restores the wind rose stats saved today, or this hour 
+/// for the hourly stats, and saves them from now on.
+/// </summary>
+/// <param name="time">Current time, sec.</param>
+/// <returns>True if today's rose was restored.</returns>
+bool WindDirection::recoverRose(unsigned long time) {
+	if (!_isDatafile) {
+		return false;
+	}
+	_isRoseFile = true;
+	String path = sensorFilepath("_rose", ".bin");
+	if (!LittleFS.exists(path.c_str())) {
+		return false;
+	}
+	RoseFile rose;
+	File file = LittleFS.open(path.c_str(), FILE_READ);
+	bool isOK = file && file.read((uint8_t*)&rose, sizeof(rose)) == sizeof(rose);
+	if (file) {
+		file.close();
+	}
+	isOK = isOK
+		&& rose.magic == ROSE_MAGIC
+		&& rose.version == ROSE_VERSION
+		&& rose.statsSize == sizeof(CircularStats)
+		&& rose.crc == Utilities::crc32(&rose, offsetof(RoseFile, crc));
+	if (!isOK) {
+		Serial.printf("WARNING: WindDirection ignored invalid %s\n", path.c_str());
+		return false;
+	}
+	// A rose saved on another day, or in the future, is stale.
+	if (rose.time > time || rose.time / 86400UL != time / 86400UL) {
+		return false;
+	}
+	_stats_day = rose.day;
+	if (rose.time / 3600UL == time / 3600UL) {
+		_stats_60_min = rose.hour;
+		_stats_lastHour = rose.lastHour;
+	}
+	return true;
+}
+
+/// <summary>
+/// Returns the direction stats of a period: the readings 
+/// since the last 10-min period, the last whole hour, or 
+/// today's 10-min periods.
+/// </summary>
+/// <param name="period">PERIOD_10_MIN, PERIOD_60_MIN or PERIOD_DAY.</param>
+const CircularStats& WindDirection::stats(dataPeriod period) const {
+	switch (period)
+	{
+	case App_Settings::PERIOD_60_MIN:
+		return _stats_lastHour;
+	case App_Settings::PERIOD_DAY:
+		return _stats_day;
+	default:
+		return _stats_10_min;
+	}
+}
+
+/// <summary>
+/// Returns the wind rose of a period (see stats()) as 
+/// "angle,percent" per sector, delimited by "~".
+/// </summary>
+/// <param name="period">PERIOD_10_MIN, PERIOD_60_MIN or PERIOD_DAY.</param>
+String WindDirection::roseString(dataPeriod period) const {
+	const CircularStats& rose = stats(period);
+	String s;
+	for (unsigned int i = 0; i < CircularStats::SECTORS; i++) {
+		if (i > 0) {
+			s += "~";
+		}
+		s += String(CircularStats::sectorAngle(i), 1) + "," + String(rose.sectorPercent(i), 1);
 	}
+	return s;
 }
 
 /// <summary>
@@ -81,8 +227,8 @@ void WindDirection::addReading(long time, float degrees, float speed) {
 /// </summary>
 /// <param name="degrees">Angle, degrees.</param>
 /// <returns></returns>
-double WindDirection::e_Component(float degrees) {
-	return sin(degrees / DEGREES_PER_RADIAN);
+float WindDirection::e_Component(float degrees) {
+	return FastTrig::sinDeg(degrees);
 }
 
 /// <summary>
@@ -90,8 +236,8 @@ double WindDirection::e_Component(float degrees) {
 /// </summary>
 /// <param name="degrees">Angle, degrees.</param>
 /// <returns></returns>
-double WindDirection::n_Component(float degrees) {
-	return cos(degrees / DEGREES_PER_RADIAN);
+float WindDirection::n_Component(float degrees) {
+	return FastTrig::cosDeg(degrees);
 }
 
 /// <summary>
@@ -127,7 +273,7 @@ float WindDirection::angleFromComponents(double n, double e) {
 
 		angle(azimuth) = 360 - angle(polar)
 	*/
-	float angle = atan2(n, e) * DEGREES_PER_RADIAN;
+	float angle = FastTrig::atan2Deg(n, e);
 	if (angle < 0) {
 		angle = 360 + angle;
 	}
@@ -201,20 +347,17 @@ list<String> WindDirection::directions_cardinal(list<float>& angleList) {
 /// <param name="targetList">List of data points with angle values.</param>
 /// <param name="numElements">Number of elements from the end to average.</param>
 /// <returns>Average angle, degrees.</returns>
-float WindDirection::angleAvg_ofList(list<dataPoint>& targetList, int numElements) {
+float WindDirection::angleAvg_ofList(SeriesView targetList, int numElements) {
 	double xSum = 0, ySum = 0;
 	// Ensure we don't iterate past the first element.
 	if (numElements > targetList.size()) {
 		numElements = targetList.size();
 	}
 	// Iterate through the last (most recent) numElements elements.
-	auto it = targetList.rbegin();	// Reverse iterator to last element.
-	for (int i = 0; i < numElements; i++)
+	for (unsigned int i = targetList.size() - numElements; i < targetList.size(); i++)
 	{
-		dataPoint dp = *it;
-		xSum += e_Component(dp.value);
-		ySum += n_Component(dp.value);
-		it++;	// next element.
+		xSum += e_Component(targetList[i].value);
+		ySum += n_Component(targetList[i].value);
 	}
 	return angleFromComponents(xSum, ySum);	// count cancels out!
 }
\ No newline at end of file
@@ -10,6 +10,8 @@
 #endif
 
 #include "SensorData.h"
+#include "FastTrig.h"
+#include "CircularStats.h"
 
 /// <summary>
 /// Object that reads and handles wind direction measurements.
@@ -24,16 +26,34 @@ private:
 	double _nSum = 0;	// Accumulated sum of y-component of direction vector.
 	float _bearing = 0;	// Wind direction in degrees.
 
-	float angleFromComponents(double n, double e);
-	double e_Component(float degrees);
-	double n_Component(float degrees);
+	CircularStats _stats_10_min;	// Directions since last 10-min processing.
+	CircularStats _stats_60_min;	// Directions of the 10-min periods of this hour.
+	CircularStats _stats_day;		// Directions of the 10-min periods of today.
+	CircularStats _stats_lastHour;	// Directions of the last whole hour.
+	SensorData _sigmaTheta;			// Sigma-theta of each 10-min period.
 
 	/// <summary>
-	/// Return cardinal direction for specified wind angle (deg).
+	/// Wind rose file: the stats of today and of this hour, 
+	/// so that a restart does not lose them.
 	/// </summary>
-	/// <param name="angle">Wind angle, deg.</param>
-	/// <returns>Wind cardinal direction.</returns>
-	String directionCardinal(float angle);
+	struct RoseFile {
+		uint32_t magic;			// ROSE_MAGIC.
+		uint16_t version;		// ROSE_VERSION.
+		uint16_t statsSize;		// sizeof(CircularStats).
+		uint32_t time;			// Time saved, sec.
+		CircularStats day;		// _stats_day.
+		CircularStats hour;		// _stats_60_min.
+		CircularStats lastHour;	// _stats_lastHour.
+		uint32_t crc;			// CRC-32 of the fields above.
+	};
+	static const uint32_t ROSE_MAGIC = 0x45534F52;	// "ROSE"
+	static const uint16_t ROSE_VERSION = 1;
+	bool _isRoseFile = false;	// Set by recoverRose(); saves rose after each period.
+
+	void saveRose(unsigned long time);
+	float angleFromComponents(double n, double e);
+	float e_Component(float degrees);
+	float n_Component(float degrees);
 
 public:
 
@@ -66,6 +86,43 @@ public:
 	/// <param name="speed">Speed at time of reading, mph.</param>
 	void addReading(long time, float degrees, float speed);	// OVERLOAD
 
+	/// <summary>
+	/// Adds the 10-min sigma-theta to its sensor and rolls the
+	/// wind rose stats up, then processes the averages.
+	/// </summary>
+	/// <param name="period">Period that has ended.</param>
+	void process_data(dataPeriod period) override;
+
+	/// <summary>
+	/// Sensor that gets the Yamartino standard deviation of 
+	/// direction (sigma-theta) of each 10-min period, deg. 
+	/// Register it after this instance.
+	/// </summary>
+	SensorData& sigmaTheta() { return _sigmaTheta; }
+
+	/// <summary>
+	/// Returns the direction stats of a period: the readings 
+	/// since the last 10-min period, the last whole hour, or 
+	/// today's 10-min periods.
+	/// </summary>
+	/// <param name="period">PERIOD_10_MIN, PERIOD_60_MIN or PERIOD_DAY.</param>
+	const CircularStats& stats(dataPeriod period) const;
+
+	/// <summary>
+	/// Returns the wind rose of a period (see stats()) as 
+	/// "angle,percent" per sector, delimited by "~".
+	/// </summary>
+	/// <param name="period">PERIOD_10_MIN, PERIOD_60_MIN or PERIOD_DAY.</param>
+	String roseString(dataPeriod period) const;
+
+	/// <summary>
+	/// Restores the wind rose stats saved today, or this hour 
+	/// for the hourly stats, and saves them from now on.
+	/// </summary>
+	/// <param name="time">Current time, sec.</param>
+	/// <returns>True if today's rose was restored.</returns>
+	bool recoverRose(unsigned long time);
+
 	// <summary>
 	/// Average wind direction from current accumulated readings, deg.
 	/// </summary>
@@ -79,6 +136,13 @@ public:
 	/// <returns>Cardinal direction as string.</returns>
 	String directionCardinal();
 
+	/// <summary>
+	/// Return cardinal direction for specified wind angle (deg).
+	/// </summary>
+	/// <param name="angle">Wind angle, deg.</param>
+	/// <returns>Wind cardinal direction.</returns>
+	String directionCardinal(float angle);
+
 	/// <summary>
 	/// Returns list of cardinal directions from list of wind angles.
 	/// </summary>
@@ -94,7 +158,7 @@ public:
 	/// <param name="targetList">List of data points with angle values.</param>
 	/// <param name="numElements">Number of elements from the end to average.</param>
 	/// <returns>Average angle, degrees.</returns>
-	float angleAvg_ofList(list<dataPoint>& targetList, int numElements);
+	float angleAvg_ofList(SeriesView targetList, int numElements);
 };
 
 #endif
@@ -22,12 +22,9 @@ WindSpeed::WindSpeed(
 	bool isUseSmoothing,
 	unsigned int numValuesForAvg,
 	float outlierDelta
-)
+) : SensorData(true, false, isUseSmoothing, numValuesForAvg, outlierDelta)
 {
 	_calibrationFactor = calibrationFactor;
-	_isUseSmoothing = isUseSmoothing;
-	_avgMoving_Num = numValuesForAvg;
-	_outlierDelta = outlierDelta;
 }
 
 /// <summary>
@@ -47,32 +44,6 @@ float WindSpeed::speedInstant(int rotations, float period)
 	return rotations * _calibrationFactor / period;
 }
 
-/// <summary>
-/// Checks for and returns a gust datPoint if the speed satisfies 
-/// gust criteria. Otherwise, the returned value will be zero if 
-/// the speed doesn't satisfy gust criteria.
-/// </summary>
-/// <param name="speed">(time, value) point to evaluate for gust.</param>
-/// <param name="avgSpeed">Current average wind speed.</param>
-/// <returns>Gust as (time, value) data point.</returns>
-dataPoint WindSpeed::gust(dataPoint speed, float avgSpeed)
-{
-	if (
-		// If Gust exceeds threshold
-		speed.value >= GUST_THRESHOLD
-		&&
-		// If gust exceeds moving avg by GUST_SPREAD
-		((speed.value - _avgMoving) >= GUST_SPREAD)	// Inherit moving avg from SensorData.
-		)
-	{		// Report this as a gust.
-		return speed;
-	}
-	else {
-		// Not a gust, so return value of zero.
-		return dataPoint(speed.time, 0);
-	}
-}
-
 /// <summary>
 /// Returns wind speed description in Beaufort 
 /// wind strength scale.
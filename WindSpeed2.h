@@ -30,10 +30,6 @@ private:
 
 	float _calibrationFactor;			// Anemometer calibration factor to convert rotations to speed.
 
-	// For identification of gusts.
-	const float GUST_THRESHOLD = 18.41;	// WindSpeed must exceed this to be a gust.
-	const float GUST_SPREAD = 10.36;	// WindSpeed must exceed low by this amount to be a gust.
-
 public:
 
 	// Constructor	
@@ -62,16 +58,6 @@ public:
 	/// <param name="period">Time period of rotations, sec.</param>
 	/// <returns>Wind speed, mph</returns>
 	float speedInstant(int rotations, float period);
-		
-	/// <summary>
-	/// Checks for and returns a gust datPoint if the speed satisfies 
-	/// gust criteria. Otherwise, the returned value will be zero if 
-	/// the speed doesn't satisfy gust criteria.
-	/// </summary>
-	/// <param name="speed">(time, value) point to evaluate for gust.</param>
-	/// <param name="avgSpeed">Current average wind speed.</param>
-	/// <returns>Gust as (time, value) data point.</returns>
-	dataPoint gust(dataPoint speed, float avgSpeed);
 
 	/// <summary>
 	/// Returns wind speed description in Beaufort 
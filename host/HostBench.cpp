@@ -0,0 +1,30 @@
+// HostBench.cpp - runs Testing benchmarks on the host.
+//
+// Usage: host_bench
+// Timings are for comparing before and after a change on one
+// machine; they are not the times on the ESP32.
+
+#include "Testing.h"
+#include "FileOperations.h"
+#include <LittleFS.h>
+
+int main() {
+	if (!LittleFS.begin()) {
+		Serial.println("ERROR: host LittleFS directory could not be created.");
+		return 1;
+	}
+	Testing test;
+	unsigned int errors = 0;
+
+	test.benchmarkRingBuffer(200000);
+	test.benchmarkFileRead(LittleFS, 4096, 200);
+	test.benchmarkFastTrig(1000000);
+
+	// Served page, read from the repo's data folder.
+	fs::FS data(WEATHER_DATA_DIR);
+	String page = FileOperations::fileRead(data, "/html/summary.html");
+	errors += test.benchmarkPlaceholders(page, 2000);
+
+	LittleFS.end();
+	return (errors > 0) ? 1 : 0;
+}
@@ -0,0 +1,75 @@
+// HostTests.cpp - runs Testing checks on the host.
+//
+// Usage: host_tests [check name]
+// With no name, runs every check. Returns 1 if any check fails.
+
+#include "Testing.h"
+#include "FileOperations.h"
+#include <LittleFS.h>
+
+namespace {
+
+	Testing test;
+
+	/// <summary>
+	/// A named check that returns its number of failures.
+	/// </summary>
+	struct HostCheck {
+		const char* name;
+		unsigned int(*run)();
+	};
+
+	const HostCheck CHECKS[] = {
+		{ "SlidingWindow", [] {
+			unsigned int errors = 0;
+			for (unsigned int windowSize : { 1u, 2u, 5u, 17u, 30u }) {
+				errors += test.testSlidingWindow(windowSize, 5000);
+			}
+			return errors;
+		} },
+		{ "SeriesWriter", [] { return test.testSeriesWriter(); } },
+		{ "SeriesStore", [] { return test.testSeriesStore(LittleFS); } },
+		{ "LogBuffer", [] { return test.testLogBuffer(); } },
+		{ "SensorRegistry", [] { return test.testSensorRegistry(); } },
+		{ "Placeholders", [] {
+			// Served page, read from the repo's data folder.
+			fs::FS data(WEATHER_DATA_DIR);
+			return test.testPlaceholders(FileOperations::fileRead(data, "/html/summary.html"));
+		} },
+		{ "PageCache", [] { return test.testPageCache(LittleFS); } },
+		{ "Replay", [] { return test.testReplay(1) + test.testReplay(32); } },
+		{ "PhaseTimer", [] { return test.testPhaseTimer(); } },
+		{ "SensorScheduler", [] { return test.testSensorScheduler(); } },
+		{ "SpscQueue", [] { return test.testSpscQueue(); } },
+		{ "Seqlock", [] { return test.testSeqlock(); } },
+		{ "TimerTicks", [] { return test.testTimerTicks(); } },
+		{ "AnemometerPulses", [] { return test.testAnemometerPulses(); } },
+		{ "FastTrig", [] { return test.testFastTrig(); } },
+		{ "CircularStats", [] { return test.testCircularStats(); } },
+		{ "WindAggregator", [] { return test.testWindAggregator(); } },
+		{ "CompactSeries", [] { return test.testCompactSeries(); } },
+		{ "SeriesArchive", [] { return test.testSeriesArchive(LittleFS); } }
+	};
+}
+
+int main(int argc, char** argv) {
+	if (!LittleFS.begin()) {
+		Serial.println("ERROR: host LittleFS directory could not be created.");
+		return 1;
+	}
+	unsigned int errors = 0;
+	bool isFound = false;
+	for (const HostCheck& check : CHECKS) {
+		if (argc > 1 && strcmp(argv[1], check.name) != 0) {
+			continue;
+		}
+		isFound = true;
+		errors += check.run();
+	}
+	LittleFS.end();
+	if (!isFound) {
+		Serial.printf("ERROR: no check named %s.\n", argv[1]);
+		return 1;
+	}
+	return (errors > 0) ? 1 : 0;
+}
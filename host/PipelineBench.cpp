@@ -0,0 +1,165 @@
+// PipelineBench.cpp - times the per-tick sensor pipeline on the host,
+// and compares the times with a baseline file.
+//
+// Usage: pipeline_bench [--iterations N] [--rounds N]
+//                       [--baseline FILE] [--threshold PERCENT]
+//                       [--write-baseline FILE]
+//
+// Each operation is timed --rounds times and the fastest kept, to
+// reduce noise. With --baseline, returns 1 if any operation is more
+// than --threshold percent (default 25) slower than its baseline.
+// Baselines are per machine: write one before a change, then check
+// against it after.
+
+#include "Testing.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+
+	const unsigned int MAX_RESULTS = 16;
+
+	/// <summary>
+	/// A baseline time, read from a baseline file.
+	/// </summary>
+	struct Baseline {
+		char name[48];
+		float nsPerOp;
+	};
+
+	/// <summary>
+	/// Reads "name ns_per_op" lines; "#" starts a comment line.
+	/// </summary>
+	/// <returns>Number of baselines read, or -1 if the file
+	/// could not be opened.</returns>
+	int readBaseline(const char* path, Baseline* baselines, unsigned int maxBaselines) {
+		FILE* file = fopen(path, "r");
+		if (file == nullptr) {
+			return -1;
+		}
+		char line[128];
+		unsigned int count = 0;
+		while (count < maxBaselines && fgets(line, sizeof(line), file) != nullptr) {
+			if (line[0] == '#') {
+				continue;
+			}
+			Baseline& baseline = baselines[count];
+			if (sscanf(line, "%47s %f", baseline.name, &baseline.nsPerOp) == 2) {
+				count++;
+			}
+		}
+		fclose(file);
+		return (int)count;
+	}
+
+	bool writeBaseline(const char* path, const Testing::BenchmarkResult* results, unsigned int count) {
+		FILE* file = fopen(path, "w");
+		if (file == nullptr) {
+			return false;
+		}
+		fprintf(file, "# pipeline_bench baseline, ns/op (fastest of rounds). Per machine;\n");
+		fprintf(file, "# regenerate with: pipeline_bench --write-baseline <this file>\n");
+		for (unsigned int i = 0; i < count; i++) {
+			fprintf(file, "%s %.1f\n", results[i].name, results[i].nsPerOp);
+		}
+		fclose(file);
+		return true;
+	}
+}
+
+int main(int argc, char** argv) {
+	unsigned long iterations = 200000;
+	unsigned int rounds = 5;
+	float thresholdPercent = 25;
+	const char* baselinePath = nullptr;
+	const char* writePath = nullptr;
+	for (int i = 1; i < argc; i++) {
+		bool hasValue = i + 1 < argc;
+		if (hasValue && strcmp(argv[i], "--iterations") == 0) {
+			iterations = strtoul(argv[++i], nullptr, 10);
+		}
+		else if (hasValue && strcmp(argv[i], "--rounds") == 0) {
+			rounds = (unsigned int)strtoul(argv[++i], nullptr, 10);
+		}
+		else if (hasValue && strcmp(argv[i], "--threshold") == 0) {
+			thresholdPercent = strtof(argv[++i], nullptr);
+		}
+		else if (hasValue && strcmp(argv[i], "--baseline") == 0) {
+			baselinePath = argv[++i];
+		}
+		else if (hasValue && strcmp(argv[i], "--write-baseline") == 0) {
+			writePath = argv[++i];
+		}
+		else {
+			Serial.printf("ERROR: unknown argument %s.\n", argv[i]);
+			return 2;
+		}
+	}
+	if (iterations == 0 || rounds == 0) {
+		Serial.println("ERROR: iterations and rounds must be more than zero.");
+		return 2;
+	}
+
+	// Fastest of the rounds for each operation.
+	Testing test;
+	Testing::BenchmarkResult best[MAX_RESULTS];
+	Testing::BenchmarkResult round[MAX_RESULTS];
+	unsigned int count = 0;
+	for (unsigned int r = 0; r < rounds; r++) {
+		count = test.benchmarkPipeline(round, MAX_RESULTS, iterations);
+		for (unsigned int i = 0; i < count; i++) {
+			if (r == 0 || round[i].nsPerOp < best[i].nsPerOp) {
+				best[i] = round[i];
+			}
+		}
+	}
+
+	Serial.printf("\nFastest of %u rounds:\n", rounds);
+	for (unsigned int i = 0; i < count; i++) {
+		Serial.printf("%-32s %10.1f ns/op\n", best[i].name, best[i].nsPerOp);
+	}
+
+	if (writePath != nullptr) {
+		if (!writeBaseline(writePath, best, count)) {
+			Serial.printf("ERROR: could not write baseline %s.\n", writePath);
+			return 2;
+		}
+		Serial.printf("Baseline written to %s.\n", writePath);
+	}
+
+	if (baselinePath == nullptr) {
+		return 0;
+	}
+	Baseline baselines[MAX_RESULTS];
+	int numBaselines = readBaseline(baselinePath, baselines, MAX_RESULTS);
+	if (numBaselines < 0) {
+		Serial.printf("ERROR: could not read baseline %s.\n", baselinePath);
+		return 2;
+	}
+	unsigned int regressions = 0;
+	Serial.printf("\nAgainst %s (threshold +%.0f%%):\n", baselinePath, thresholdPercent);
+	for (unsigned int i = 0; i < count; i++) {
+		const Baseline* baseline = nullptr;
+		for (int b = 0; b < numBaselines; b++) {
+			if (strcmp(baselines[b].name, best[i].name) == 0) {
+				baseline = &baselines[b];
+			}
+		}
+		if (baseline == nullptr || baseline->nsPerOp <= 0) {
+			Serial.printf("%-32s %10.1f ns/op  (no baseline)\n", best[i].name, best[i].nsPerOp);
+			continue;
+		}
+		float changePercent = 100.0f * (best[i].nsPerOp - baseline->nsPerOp) / baseline->nsPerOp;
+		bool isRegression = changePercent > thresholdPercent;
+		regressions += isRegression;
+		Serial.printf("%-32s %10.1f ns/op  %+7.1f%%%s\n", best[i].name, best[i].nsPerOp,
+			changePercent, isRegression ? "  REGRESSION" : "");
+	}
+	if (regressions > 0) {
+		Serial.printf("ERROR: %u operations slower than baseline by more than %.0f%%.\n",
+			regressions, thresholdPercent);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,61 @@
+// ReplayMain.cpp - replays simulated days through the sensor pipeline
+// on a virtual clock, and reports throughput and peak memory.
+//
+// Usage: replay [--days N] [--start UNIX_TIME]
+//
+// Default is 31 days from 2024-01-01, which wraps every data list
+// (including the 30-day SIZE_DAY_LIST).
+
+#include "Replay.h"
+#include <cstring>
+#include <cstdlib>
+#include <sys/resource.h>
+
+namespace {
+
+	/// <summary>
+	/// Returns peak resident memory of this process, KB.
+	/// </summary>
+	long peakMemory_KB() {
+		struct rusage usage;
+		getrusage(RUSAGE_SELF, &usage);
+		return usage.ru_maxrss;
+	}
+}
+
+int main(int argc, char** argv) {
+	unsigned long days = 31;
+	unsigned long startTime = 1704067200UL;	// 2024-01-01 00:00:00.
+	for (int i = 1; i < argc; i++) {
+		bool hasValue = i + 1 < argc;
+		if (hasValue && strcmp(argv[i], "--days") == 0) {
+			days = strtoul(argv[++i], nullptr, 10);
+		}
+		else if (hasValue && strcmp(argv[i], "--start") == 0) {
+			startTime = strtoul(argv[++i], nullptr, 10);
+		}
+		else {
+			Serial.printf("ERROR: unknown argument %s.\n", argv[i]);
+			return 2;
+		}
+	}
+
+	long memoryStart_KB = peakMemory_KB();
+	SimulatedStation station;
+	Replay replay(station.sensors,
+		[&station](TickSample& sample) { station.read(sample); },
+		[&station](const TickSample& sample) { station.apply(sample); });
+	Replay::Stats stats = replay.run(startTime, days * BASE_PERIODS_IN_24_HR);
+
+	Serial.printf("Replayed %lu days: %lu ticks, %lu 10-min, %lu 60-min, %lu day periods\n",
+		days, stats.ticks, stats.periods_10_min, stats.periods_60_min, stats.days);
+	Serial.printf("Wall time   %10.3f s\n", stats.elapsed_us / 1e6);
+	Serial.printf("Throughput  %10.0f ticks/s (%.0fx real time)\n",
+		stats.ticksPerSecond(), stats.ticksPerSecond() * BASE_PERIOD_SEC);
+	Serial.printf("Peak memory %10ld KB (%ld KB before replay)\n", peakMemory_KB(), memoryStart_KB);
+	Serial.printf("Station objects %6u bytes\n", (unsigned int)sizeof(station));
+	Serial.printf("Temperature lists: 10-min %u, 60-min %u, day max %u\n",
+		station.temp_F.data_10_min().size(), station.temp_F.data_60_min().size(),
+		station.temp_F.data_day_maxima().size());
+	return 0;
+}
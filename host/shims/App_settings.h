@@ -0,0 +1,2 @@
+// App_settings.h - host shim; some sources include App_Settings.h by this name.
+#include "../../App_Settings.h"
@@ -0,0 +1,131 @@
+// FS.cpp - host shim of fs::FS backed by a host directory.
+
+#include "FS.h"
+#include "LittleFS.h"
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstring>
+#include <ftw.h>
+
+fs::LittleFSFS LittleFS;
+
+using namespace fs;
+
+File::File(std::FILE* fp, const std::string& path, bool isDir)
+	: _fp(fp, [](std::FILE* f) { if (f) { std::fclose(f); } }), _path(path), _isDir(isDir) {}
+
+size_t File::write(const uint8_t* buf, size_t size) {
+	return _fp ? std::fwrite(buf, 1, size, _fp.get()) : 0;
+}
+
+size_t File::print(const char* s) {
+	return write((const uint8_t*)s, strlen(s));
+}
+
+int File::available() {
+	if (!_fp) {
+		return 0;
+	}
+	return (int)(size() - position());
+}
+
+int File::read() {
+	return _fp ? std::fgetc(_fp.get()) : -1;
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+	return _fp ? std::fread(buf, 1, size, _fp.get()) : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+	return _fp && std::fseek(_fp.get(), (long)pos, (int)mode) == 0;
+}
+
+size_t File::position() const {
+	return _fp ? (size_t)std::ftell(_fp.get()) : 0;
+}
+
+size_t File::size() const {
+	if (!_fp) {
+		return 0;
+	}
+	long pos = std::ftell(_fp.get());
+	std::fseek(_fp.get(), 0, SEEK_END);
+	long end = std::ftell(_fp.get());
+	std::fseek(_fp.get(), pos, SEEK_SET);
+	return (size_t)end;
+}
+
+void File::flush() {
+	if (_fp) {
+		std::fflush(_fp.get());
+	}
+}
+
+void File::close() {
+	_fp.reset();
+	_isDir = false;
+}
+
+const char* File::name() const {
+	const char* slash = strrchr(_path.c_str(), '/');
+	return slash ? slash + 1 : _path.c_str();
+}
+
+File FS::open(const char* path, const char* mode, bool create) {
+	std::string hp = hostPath(path);
+	struct stat st;
+	if (stat(hp.c_str(), &st) == 0 && S_ISDIR(st.st_mode)) {
+		return File(nullptr, path, true);
+	}
+	// ESP32 "r" is text-agnostic; use binary on the host.
+	std::string m = std::string(mode) + "b";
+	std::FILE* fp = std::fopen(hp.c_str(), m.c_str());
+	if (!fp) {
+		return File();
+	}
+	return File(fp, path);
+}
+
+bool FS::exists(const char* path) {
+	struct stat st;
+	return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char* path) {
+	return std::remove(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char* pathFrom, const char* pathTo) {
+	return std::rename(hostPath(pathFrom).c_str(), hostPath(pathTo).c_str()) == 0;
+}
+
+bool FS::mkdir(const char* path) {
+	return ::mkdir(hostPath(path).c_str(), 0755) == 0 || exists(path);
+}
+
+bool FS::rmdir(const char* path) {
+	return ::rmdir(hostPath(path).c_str()) == 0;
+}
+
+bool LittleFSFS::begin(bool formatOnFail) {
+	if (_root.empty()) {
+		char tmpl[] = "/tmp/littlefs_XXXXXX";
+		const char* dir = mkdtemp(tmpl);
+		if (!dir) {
+			return false;
+		}
+		_root = dir;
+	}
+	return true;
+}
+
+void LittleFSFS::end() {
+	if (_root.empty()) {
+		return;
+	}
+	nftw(_root.c_str(), [](const char* path, const struct stat*, int, struct FTW*) {
+		return ::remove(path);
+	}, 16, FTW_DEPTH | FTW_PHYS);
+	_root.clear();
+}
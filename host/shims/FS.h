@@ -0,0 +1,72 @@
+// FS.h - host shim of the ESP32 fs::FS API, backed by a host directory
+#ifndef _HOST_FS_h
+#define _HOST_FS_h
+
+#include <cstdio>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "WString.h"
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+	enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+	class File {
+		std::shared_ptr<std::FILE> _fp;
+		std::string _path;
+		bool _isDir = false;
+	public:
+		File() {}
+		File(std::FILE* fp, const std::string& path, bool isDir = false);
+		operator bool() const { return _fp != nullptr || _isDir; }
+		size_t write(uint8_t c) { return write(&c, 1); }
+		size_t write(const uint8_t* buf, size_t size);
+		size_t print(const char* s);
+		size_t print(const String& s) { return print(s.c_str()); }
+		int available();
+		int read();
+		size_t read(uint8_t* buf, size_t size);
+		bool seek(uint32_t pos, SeekMode mode = SeekSet);
+		size_t position() const;
+		size_t size() const;
+		void flush();
+		void close();
+		bool isDirectory() const { return _isDir; }
+		const char* name() const;
+		const char* path() const { return _path.c_str(); }
+		File openNextFile() { return File(); }
+	};
+
+	/// Host file system rooted at a directory.
+	class FS {
+	protected:
+		std::string _root;
+	public:
+		explicit FS(const std::string& root = "") : _root(root) {}
+		void setRoot(const std::string& root) { _root = root; }
+		const std::string& root() const { return _root; }
+		std::string hostPath(const char* path) const { return _root + path; }
+		File open(const char* path, const char* mode = FILE_READ, bool create = false);
+		File open(const String& path, const char* mode = FILE_READ, bool create = false) { return open(path.c_str(), mode, create); }
+		bool exists(const char* path);
+		bool exists(const String& path) { return exists(path.c_str()); }
+		bool remove(const char* path);
+		bool rename(const char* pathFrom, const char* pathTo);
+		bool mkdir(const char* path);
+		bool mkdir(const String& path) { return mkdir(path.c_str()); }
+		bool rmdir(const char* path);
+	};
+}
+
+using fs::FS;
+using fs::File;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
+
+#endif
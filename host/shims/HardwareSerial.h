@@ -0,0 +1,27 @@
+// HardwareSerial.h - host shim that prints to stdout
+#ifndef _HOST_HARDWARESERIAL_h
+#define _HOST_HARDWARESERIAL_h
+
+#include <cstdio>
+#include "WString.h"
+
+class HardwareSerial {
+public:
+	void begin(unsigned long) {}
+	int printf(const char* fmt, ...);
+	size_t print(const String& s);
+	size_t print(const char* s);
+	size_t print(char c);
+	size_t print(int v);
+	size_t print(unsigned int v);
+	size_t print(long v);
+	size_t print(unsigned long v);
+	size_t print(double v, int decimalPlaces = 2);
+	size_t println();
+	template <typename T> size_t println(const T& v) { size_t n = print(v); return n + println(); }
+	size_t println(double v, int decimalPlaces) { size_t n = print(v, decimalPlaces); return n + println(); }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,19 @@
+// LittleFS.h - host shim; LittleFS is a directory on the host
+#ifndef _HOST_LITTLEFS_h
+#define _HOST_LITTLEFS_h
+
+#include "FS.h"
+
+namespace fs {
+	class LittleFSFS : public FS {
+	public:
+		bool begin(bool formatOnFail = false);
+		void end();		// Removes the temp directory.
+		size_t totalBytes() { return 0x1E0000; }
+		size_t usedBytes() { return 0; }
+	};
+}
+
+extern fs::LittleFSFS LittleFS;
+
+#endif
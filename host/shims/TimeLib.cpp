@@ -0,0 +1,22 @@
+// TimeLib.cpp - host shim; a virtual clock the host runner can set.
+
+#include "TimeLib.h"
+
+static unsigned long _timeNow = 0;
+
+static struct tm timeParts() {
+	time_t t = (time_t)_timeNow;
+	struct tm parts;
+	gmtime_r(&t, &parts);
+	return parts;
+}
+
+unsigned long now() { return _timeNow; }
+void setTime(unsigned long t) { _timeNow = t; }
+void adjustTime(long adjustment) { _timeNow += adjustment; }
+int year() { return timeParts().tm_year + 1900; }
+int month() { return timeParts().tm_mon + 1; }
+int day() { return timeParts().tm_mday; }
+int hour() { return timeParts().tm_hour; }
+int minute() { return timeParts().tm_min; }
+int second() { return timeParts().tm_sec; }
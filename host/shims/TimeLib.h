@@ -0,0 +1,19 @@
+// TimeLib.h - host shim; time is a settable virtual clock
+#ifndef _HOST_TIMELIB_h
+#define _HOST_TIMELIB_h
+
+#include <ctime>
+
+typedef unsigned long time_t_host;
+
+unsigned long now();
+void setTime(unsigned long t);
+void adjustTime(long adjustment);
+int year();
+int month();
+int day();
+int hour();
+int minute();
+int second();
+
+#endif
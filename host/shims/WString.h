@@ -0,0 +1,66 @@
+// WString.h - host shim of the Arduino String class
+#ifndef _HOST_WSTRING_h
+#define _HOST_WSTRING_h
+
+#include <string>
+#include <cstring>
+
+class String {
+	std::string _s;
+public:
+	String() {}
+	String(const char* s) : _s(s ? s : "") {}
+	String(const std::string& s) : _s(s) {}
+	String(char c) : _s(1, c) {}
+	explicit String(int v);
+	explicit String(unsigned int v);
+	explicit String(long v);
+	explicit String(unsigned long v);
+	explicit String(float v, unsigned int decimalPlaces = 2);
+	explicit String(double v, unsigned int decimalPlaces = 2);
+
+	const char* c_str() const { return _s.c_str(); }
+	unsigned int length() const { return (unsigned int)_s.length(); }
+	bool reserve(unsigned int size) { _s.reserve(size); return true; }
+	bool isEmpty() const { return _s.empty(); }
+
+	String& operator+=(const String& rhs) { _s += rhs._s; return *this; }
+	String& operator+=(const char* rhs) { _s += rhs; return *this; }
+	String& operator+=(char c) { _s += c; return *this; }
+	String& operator+=(int v) { return *this += String(v); }
+	String& operator+=(unsigned int v) { return *this += String(v); }
+	String& operator+=(long v) { return *this += String(v); }
+	String& operator+=(unsigned long v) { return *this += String(v); }
+	String& operator+=(float v) { return *this += String(v); }
+	String& operator+=(double v) { return *this += String(v); }
+	bool concat(const char* s, unsigned int len) { _s.append(s, len); return true; }
+	bool concat(const String& s) { _s += s._s; return true; }
+	bool concat(char c) { _s += c; return true; }
+
+	bool operator==(const String& rhs) const { return _s == rhs._s; }
+	bool operator==(const char* rhs) const { return _s == rhs; }
+	bool operator!=(const String& rhs) const { return _s != rhs._s; }
+	bool operator!=(const char* rhs) const { return _s != rhs; }
+	bool operator<(const String& rhs) const { return _s < rhs._s; }
+	bool equals(const String& rhs) const { return _s == rhs._s; }
+
+	char operator[](unsigned int i) const { return i < _s.length() ? _s[i] : 0; }
+	char charAt(unsigned int i) const { return (*this)[i]; }
+	String substring(unsigned int from) const;
+	String substring(unsigned int from, unsigned int to) const;
+	int indexOf(char c, unsigned int from = 0) const;
+	int indexOf(const String& s, unsigned int from = 0) const;
+	bool startsWith(const String& s) const { return _s.compare(0, s._s.length(), s._s) == 0; }
+	bool endsWith(const String& s) const;
+	long toInt() const { return std::strtol(_s.c_str(), nullptr, 10); }
+	float toFloat() const { return std::strtof(_s.c_str(), nullptr); }
+	void trim();
+	void toUpperCase();
+
+	friend String operator+(const String& lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+	friend String operator+(const String& lhs, const char* rhs) { String r(lhs); r += rhs; return r; }
+	friend String operator+(const char* lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+	friend String operator+(const String& lhs, char rhs) { String r(lhs); r += rhs; return r; }
+};
+
+#endif
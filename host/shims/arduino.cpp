@@ -0,0 +1,168 @@
+// arduino.cpp - host shim implementations of Arduino core functions.
+
+#include "arduino.h"
+#include <chrono>
+#include <thread>
+#include <cstdarg>
+
+HardwareSerial Serial;
+
+static const auto _timeStart = std::chrono::steady_clock::now();
+
+unsigned long millis() {
+	return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - _timeStart).count();
+}
+
+unsigned long micros() {
+	return (unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - _timeStart).count();
+}
+
+void delay(unsigned long ms) {
+	std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+long map(long x, long in_min, long in_max, long out_min, long out_max) {
+	return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+char* dtostrf(double number, signed int width, unsigned int prec, char* s) {
+	bool negative = false;
+	if (isnan(number)) {
+		strcpy(s, "nan");
+		return s;
+	}
+	if (isinf(number)) {
+		strcpy(s, "inf");
+		return s;
+	}
+	char* out = s;
+	int fillme = width;		// Cells to fill for the integer part.
+	if (prec > 0) {
+		fillme -= (prec + 1);
+	}
+	if (number < 0.0) {
+		negative = true;
+		fillme--;
+		number = -number;
+	}
+	// Round so that 1.999 with 2 places prints as "2.00".
+	double rounding = 2.0;
+	for (unsigned int i = 0; i < prec; ++i) {
+		rounding *= 10.0;
+	}
+	number += 1.0 / rounding;
+	double tenpow = 1.0;
+	unsigned int digitcount = 1;
+	while (number >= 10.0 * tenpow) {
+		tenpow *= 10.0;
+		digitcount++;
+	}
+	number /= tenpow;
+	fillme -= digitcount;
+	while (fillme-- > 0) {
+		*out++ = ' ';
+	}
+	if (negative) {
+		*out++ = '-';
+	}
+	digitcount += prec;
+	while (digitcount-- > 0) {
+		int digit = (int)number;
+		if (digit > 9) {
+			digit = 9;
+		}
+		*out++ = (char)('0' | digit);
+		if ((digitcount == prec) && (prec > 0)) {
+			*out++ = '.';
+		}
+		number -= digit;
+		number *= 10.0;
+	}
+	*out = 0;
+	return s;
+}
+
+/*****************************************************************
+	String
+******************************************************************/
+
+String::String(int v) : _s(std::to_string(v)) {}
+String::String(unsigned int v) : _s(std::to_string(v)) {}
+String::String(long v) : _s(std::to_string(v)) {}
+String::String(unsigned long v) : _s(std::to_string(v)) {}
+
+String::String(float v, unsigned int decimalPlaces) : String((double)v, decimalPlaces) {}
+
+String::String(double v, unsigned int decimalPlaces) {
+	// Same formatting as the ESP32 core.
+	char buf[128];
+	_s = dtostrf(v, decimalPlaces + 2, decimalPlaces, buf);
+}
+
+String String::substring(unsigned int from) const {
+	return substring(from, length());
+}
+
+String String::substring(unsigned int from, unsigned int to) const {
+	if (from > to) {
+		std::swap(from, to);
+	}
+	if (from >= _s.length()) {
+		return String();
+	}
+	if (to > _s.length()) {
+		to = (unsigned int)_s.length();
+	}
+	return String(_s.substr(from, to - from));
+}
+
+int String::indexOf(char c, unsigned int from) const {
+	size_t i = _s.find(c, from);
+	return i == std::string::npos ? -1 : (int)i;
+}
+
+int String::indexOf(const String& s, unsigned int from) const {
+	size_t i = _s.find(s._s, from);
+	return i == std::string::npos ? -1 : (int)i;
+}
+
+bool String::endsWith(const String& s) const {
+	return _s.length() >= s._s.length()
+		&& _s.compare(_s.length() - s._s.length(), s._s.length(), s._s) == 0;
+}
+
+void String::trim() {
+	size_t first = _s.find_first_not_of(" \t\r\n");
+	size_t last = _s.find_last_not_of(" \t\r\n");
+	_s = (first == std::string::npos) ? "" : _s.substr(first, last - first + 1);
+}
+
+void String::toUpperCase() {
+	for (char& c : _s) {
+		c = (char)toupper(c);
+	}
+}
+
+/*****************************************************************
+	Serial
+******************************************************************/
+
+int HardwareSerial::printf(const char* fmt, ...) {
+	va_list args;
+	va_start(args, fmt);
+	int n = vprintf(fmt, args);
+	va_end(args);
+	return n;
+}
+
+size_t HardwareSerial::print(const String& s) { return fputs(s.c_str(), stdout), s.length(); }
+size_t HardwareSerial::print(const char* s) { return fputs(s, stdout), strlen(s); }
+size_t HardwareSerial::print(char c) { return fputc(c, stdout), 1; }
+size_t HardwareSerial::print(int v) { return print(String(v)); }
+size_t HardwareSerial::print(unsigned int v) { return print(String(v)); }
+size_t HardwareSerial::print(long v) { return print(String(v)); }
+size_t HardwareSerial::print(unsigned long v) { return print(String(v)); }
+size_t HardwareSerial::print(double v, int decimalPlaces) { return print(String(v, decimalPlaces)); }
+size_t HardwareSerial::println() { return fputs("\r\n", stdout), 2; }
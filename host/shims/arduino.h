@@ -0,0 +1,43 @@
+// arduino.h - host shim of the Arduino core (sources include the lower-case name)
+#ifndef _HOST_ARDUINO_h
+#define _HOST_ARDUINO_h
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <string>
+#include <algorithm>
+
+#include "WString.h"
+#include "HardwareSerial.h"
+
+using std::isnan;
+using std::isinf;
+
+#define IRAM_ATTR
+#define PROGMEM
+#define F(s) (s)
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+long map(long x, long in_min, long in_max, long out_min, long out_max);
+
+// FreeRTOS spinlock stand-ins (single-threaded host).
+typedef struct { int owner; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { 0 }
+#define portENTER_CRITICAL(mux) ((void)(mux))
+#define portEXIT_CRITICAL(mux) ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux) ((void)(mux))
+
+// Port of the ESP32 core's stdlib_noniso dtostrf (used by String(float, dec)).
+char* dtostrf(double number, signed int width, unsigned int prec, char* s);
+
+#endif
@@ -0,0 +1,2 @@
+// dataPoint.h - host shim; some sources include DataPoint.h by this name.
+#include "../../DataPoint.h"